@@ -4,7 +4,67 @@
 
 #include <imgui.h>
 
+#include "Library/SrgImGuiFilteredList.h"
 #include "SrgImGuiStringConversion.h"
+#include "SrgImGuiSubsystem.h"
+#include "Telemetry/SrgImGuiPlot.h"
+#include "Telemetry/SrgImGuiTimeSeries.h"
+
+namespace SrgImGuiCoreLibrary_Private
+{
+	static_assert(static_cast<int32>(ESrgImGuiTableFlags::Resizable) == ImGuiTableFlags_Resizable);
+	static_assert(static_cast<int32>(ESrgImGuiTableFlags::BordersOuterV) == ImGuiTableFlags_BordersOuterV);
+	static_assert(static_cast<int32>(ESrgImGuiTableFlags::ScrollX) == ImGuiTableFlags_ScrollX);
+	static_assert(static_cast<int32>(ESrgImGuiTableFlags::SortTristate) == ImGuiTableFlags_SortTristate);
+
+	// The values of ImGuiTableColumnFlags changed between ImGui versions, so they are converted one by one.
+	ImGuiTableColumnFlags ToImGuiTableColumnFlags(int32 Flags)
+	{
+		static constexpr TPair<ESrgImGuiTableColumnFlags, ImGuiTableColumnFlags> FLAG_PAIRS[] = {
+			{ESrgImGuiTableColumnFlags::DefaultHide, ImGuiTableColumnFlags_DefaultHide},
+			{ESrgImGuiTableColumnFlags::DefaultSort, ImGuiTableColumnFlags_DefaultSort},
+			{ESrgImGuiTableColumnFlags::WidthStretch, ImGuiTableColumnFlags_WidthStretch},
+			{ESrgImGuiTableColumnFlags::WidthFixed, ImGuiTableColumnFlags_WidthFixed},
+			{ESrgImGuiTableColumnFlags::NoResize, ImGuiTableColumnFlags_NoResize},
+			{ESrgImGuiTableColumnFlags::NoReorder, ImGuiTableColumnFlags_NoReorder},
+			{ESrgImGuiTableColumnFlags::NoHide, ImGuiTableColumnFlags_NoHide},
+			{ESrgImGuiTableColumnFlags::NoSort, ImGuiTableColumnFlags_NoSort},
+			{ESrgImGuiTableColumnFlags::PreferSortAscending, ImGuiTableColumnFlags_PreferSortAscending},
+			{ESrgImGuiTableColumnFlags::PreferSortDescending, ImGuiTableColumnFlags_PreferSortDescending},
+		};
+
+		ImGuiTableColumnFlags ImGuiFlags = ImGuiTableColumnFlags_None;
+		for (const TPair<ESrgImGuiTableColumnFlags, ImGuiTableColumnFlags>& FlagPair : FLAG_PAIRS)
+		{
+			if (Flags & static_cast<int32>(FlagPair.Key))
+			{
+				ImGuiFlags |= FlagPair.Value;
+			}
+		}
+		return ImGuiFlags;
+	}
+
+	// Clippers live between "Begin Clipper" and the last "Clipper Step", so they are kept here instead of on the stack.
+	struct FClipper
+	{
+		TUniquePtr<ImGuiListClipper> Clipper;
+		int32 FrameCount = 0;
+	};
+
+	// Only accessed from the game thread. Leaked so that no clipper is ended after ImGui shut down.
+	static TArray<FClipper>& Clippers = *new TArray<FClipper>();
+
+	// Destroying a clipper ends it.
+	void PopClipper(bool CallEnd)
+	{
+		if (!CallEnd)
+		{
+			// Skips End() as it would move the cursor of the current window, which is not the window of the clipper.
+			Clippers.Last().Clipper->ItemsCount = -1;
+		}
+		Clippers.Pop();
+	}
+}	 // namespace SrgImGuiCoreLibrary_Private
 
 void USrgImGuiCoreLibrary::PushId(const FString& Id)
 {
@@ -266,6 +326,16 @@ bool USrgImGuiCoreLibrary::List(const FString& Label, const TArray<FString>& Ite
 	return SelectedItemIndex != PreviousSelectedItemIndex && SelectedItemIndex != INDEX_NONE;
 }
 
+bool USrgImGuiCoreLibrary::FilteredCombo(const FString& Label, const TArray<FString>& Items, int32& SelectedItemIndex)
+{
+	return SrgImGuiFilteredList::Combo(*Label, Items, SelectedItemIndex);
+}
+
+bool USrgImGuiCoreLibrary::FilteredList(const FString& Label, const TArray<FString>& Items, int32& SelectedItemIndex)
+{
+	return SrgImGuiFilteredList::List(*Label, Items, SelectedItemIndex);
+}
+
 bool USrgImGuiCoreLibrary::ColorEdit(const FString& Label, FColor& Color)
 {
 	FLinearColor LinearColor(Color);
@@ -333,7 +403,7 @@ void USrgImGuiCoreLibrary::PlotLines(const FString& Label, const TArray<float>&
 					 ImVec2(Size.X, Size.Y));
 }
 
-void USrgImGuiCoreLibrary::PlotLinesClamped(const FString& Label, const TArray<float> Data, const FString& OverlayText,
+void USrgImGuiCoreLibrary::PlotLinesClamped(const FString& Label, const TArray<float>& Data, const FString& OverlayText,
 											FVector2D Size /*= {0.f, 0.f}*/, float Min /*= 0.f*/, float Max /*= 1.f*/)
 {
 	if (Min > Max)
@@ -343,6 +413,19 @@ void USrgImGuiCoreLibrary::PlotLinesClamped(const FString& Label, const TArray<f
 	ImGui::PlotLines(TO_IMGUI(*Label), Data.GetData(), Data.Num(), 0, TO_IMGUI(*OverlayText), Min, Max, ImVec2(Size.X, Size.Y));
 }
 
+void USrgImGuiCoreLibrary::PlotLinesDecimated(const FString& Label, const TArray<float>& Data, const FString& OverlayText,
+											  FVector2D Size /*= {0.f, 0.f}*/)
+{
+	// Blueprint arrays have no version, so they are decimated every frame.
+	SrgImGuiPlot::FSeries Series;
+	Series.Samples.First = Data;
+
+	SrgImGuiPlot::FOptions Options;
+	Options.OverlayText = *OverlayText;
+	Options.Size		= Size;
+	SrgImGuiPlot::Lines(*Label, MakeArrayView(&Series, 1), Options);
+}
+
 void USrgImGuiCoreLibrary::PlotHistogram(const FString& Label, const TArray<float>& Data, const FString& OverlayText,
 										 FVector2D Size /*= {0.f, 0.f}*/)
 {
@@ -350,7 +433,7 @@ void USrgImGuiCoreLibrary::PlotHistogram(const FString& Label, const TArray<floa
 						 ImVec2(Size.X, Size.Y));
 }
 
-void USrgImGuiCoreLibrary::PlotHistogramClamped(const FString& Label, const TArray<float> Data, const FString& OverlayText,
+void USrgImGuiCoreLibrary::PlotHistogramClamped(const FString& Label, const TArray<float>& Data, const FString& OverlayText,
 												FVector2D Size /*= {0.f, 0.f}*/, float Min /*= 0.f*/, float Max /*= 1.f*/)
 {
 	if (Min > Max)
@@ -361,6 +444,28 @@ void USrgImGuiCoreLibrary::PlotHistogramClamped(const FString& Label, const TArr
 						 ImVec2(Size.X, Size.Y));
 }
 
+void USrgImGuiCoreLibrary::PlotTimeSeries(const FString& Label, const TArray<USrgImGuiTimeSeries*>& Series,
+										  const FString& OverlayText, FVector2D Size, bool FitToSamples /*= true*/,
+										  float Min /*= 0.f*/, float Max /*= 1.f*/)
+{
+	TArray<const FSrgImGuiTimeSeries*, TInlineAllocator<8>> NativeSeries;
+	for (const USrgImGuiTimeSeries* TimeSeries : Series)
+	{
+		NativeSeries.Add(TimeSeries ? &TimeSeries->GetSeries() : nullptr);
+	}
+
+	if (FitToSamples)
+	{
+		Min = FLT_MAX;
+		Max = FLT_MAX;
+	}
+	else if (Min > Max)
+	{
+		Swap(Min, Max);
+	}
+	SrgImGuiTimeSeries::Plot(*Label, NativeSeries, *OverlayText, Size, Min, Max);
+}
+
 void USrgImGuiCoreLibrary::Separator()
 {
 	ImGui::Separator();
@@ -415,3 +520,224 @@ void USrgImGuiCoreLibrary::NextColumn()
 {
 	ImGui::NextColumn();
 }
+
+bool USrgImGuiCoreLibrary::BeginTable(const FString& Id, int32 Columns, int32 Flags, FVector2D OuterSize)
+{
+	return ImGui::BeginTable(TO_IMGUI(*Id), FMath::Max(1, Columns), Flags, ImVec2(OuterSize.X, OuterSize.Y));
+}
+
+void USrgImGuiCoreLibrary::EndTable()
+{
+	ImGui::EndTable();
+}
+
+void USrgImGuiCoreLibrary::SetupTableColumn(const FString& Label, int32 Flags, float Width /*= 0.f*/)
+{
+	ImGui::TableSetupColumn(TO_IMGUI(*Label), SrgImGuiCoreLibrary_Private::ToImGuiTableColumnFlags(Flags), Width);
+}
+
+void USrgImGuiCoreLibrary::SetupTableScrollFreeze(int32 Columns /*= 0*/, int32 Rows /*= 1*/)
+{
+	ImGui::TableSetupScrollFreeze(FMath::Max(0, Columns), FMath::Max(0, Rows));
+}
+
+void USrgImGuiCoreLibrary::TableHeadersRow()
+{
+	ImGui::TableHeadersRow();
+}
+
+void USrgImGuiCoreLibrary::TableNextRow(float MinHeight /*= 0.f*/)
+{
+	ImGui::TableNextRow(ImGuiTableRowFlags_None, MinHeight);
+}
+
+bool USrgImGuiCoreLibrary::TableNextColumn()
+{
+	return ImGui::TableNextColumn();
+}
+
+bool USrgImGuiCoreLibrary::TableSetColumnIndex(int32 ColumnIndex)
+{
+	return ImGui::TableSetColumnIndex(ColumnIndex);
+}
+
+bool USrgImGuiCoreLibrary::GetTableSortSpecs(TArray<FSrgImGuiTableSortSpec>& SortSpecs)
+{
+	SortSpecs.Reset();
+	ImGuiTableSortSpecs* ImGuiSortSpecs = ImGui::TableGetSortSpecs();
+	if (!ImGuiSortSpecs)
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < ImGuiSortSpecs->SpecsCount; ++Index)
+	{
+		const ImGuiTableColumnSortSpecs& ColumnSortSpecs = ImGuiSortSpecs->Specs[Index];
+		FSrgImGuiTableSortSpec& SortSpec				 = SortSpecs.AddDefaulted_GetRef();
+		SortSpec.ColumnIndex							 = ColumnSortSpecs.ColumnIndex;
+		SortSpec.Ascending								 = ColumnSortSpecs.SortDirection != ImGuiSortDirection_Descending;
+	}
+
+	const bool SortingChanged  = ImGuiSortSpecs->SpecsDirty;
+	ImGuiSortSpecs->SpecsDirty = false;
+	return SortingChanged;
+}
+
+void USrgImGuiCoreLibrary::BeginClipper(int32 ItemCount, float ItemHeight /*= -1.f*/)
+{
+	using namespace SrgImGuiCoreLibrary_Private;
+
+	// Clippers left by a loop that exited early without calling "End Clipper" are discarded.
+	while (!Clippers.IsEmpty() && Clippers.Last().FrameCount != ImGui::GetFrameCount())
+	{
+		UE_LOG(LogSrgImGui, Warning,
+			   TEXT("A clipper was not ended. Loop until \"Clipper Step\" returns false or call \"End Clipper\"."));
+		PopClipper(false);
+	}
+
+	FClipper& Clipper  = Clippers.AddDefaulted_GetRef();
+	Clipper.Clipper	   = MakeUnique<ImGuiListClipper>();
+	Clipper.FrameCount = ImGui::GetFrameCount();
+	Clipper.Clipper->Begin(FMath::Max(0, ItemCount), ItemHeight > 0.f ? ItemHeight : -1.f);
+}
+
+bool USrgImGuiCoreLibrary::ClipperStep(int32& DisplayStart, int32& DisplayEnd)
+{
+	using namespace SrgImGuiCoreLibrary_Private;
+
+	DisplayStart = 0;
+	DisplayEnd	 = 0;
+	if (Clippers.IsEmpty())
+	{
+		UE_LOG(LogSrgImGui, Error, TEXT("\"Clipper Step\" was called without \"Begin Clipper\"."));
+		return false;
+	}
+
+	ImGuiListClipper& Clipper = *Clippers.Last().Clipper;
+	if (Clipper.Step())
+	{
+		DisplayStart = Clipper.DisplayStart;
+		DisplayEnd	 = Clipper.DisplayEnd;
+		return true;
+	}
+	PopClipper(true);
+	return false;
+}
+
+void USrgImGuiCoreLibrary::EndClipper()
+{
+	using namespace SrgImGuiCoreLibrary_Private;
+
+	if (!Clippers.IsEmpty())
+	{
+		PopClipper(true);
+	}
+}
+
+FSrgImGuiLabel USrgImGuiCoreLibrary::MakeLabel(const FString& Text)
+{
+	return FSrgImGuiLabel(Text);
+}
+
+void USrgImGuiCoreLibrary::PushIdLabel(const FSrgImGuiLabel& Id)
+{
+	ImGui::PushID(static_cast<int>(Id.GetId()));
+}
+
+bool USrgImGuiCoreLibrary::BeginWindowLabel(const FSrgImGuiLabel& Title, int32 Flags)
+{
+	return ImGui::Begin(Title.GetUtf8(), nullptr, Flags);
+}
+
+bool USrgImGuiCoreLibrary::BeginMenuLabel(const FSrgImGuiLabel& Label, bool Enabled /*= true*/)
+{
+	return ImGui::BeginMenu(Label.GetUtf8(), Enabled);
+}
+
+bool USrgImGuiCoreLibrary::MenuItemLabel(const FSrgImGuiLabel& Label, bool Enabled /*= true*/)
+{
+	return ImGui::MenuItem(Label.GetUtf8(), nullptr, false, Enabled);
+}
+
+bool USrgImGuiCoreLibrary::CollapsingHeaderLabel(const FSrgImGuiLabel& Label)
+{
+	return ImGui::CollapsingHeader(Label.GetUtf8());
+}
+
+bool USrgImGuiCoreLibrary::BeginTreeNodeLabel(const FSrgImGuiLabel& Label)
+{
+	return ImGui::TreeNode(Label.GetUtf8());
+}
+
+bool USrgImGuiCoreLibrary::BeginTabLabel(const FSrgImGuiLabel& Label)
+{
+	return ImGui::BeginTabItem(Label.GetUtf8());
+}
+
+void USrgImGuiCoreLibrary::TextColoredLabel(const FSrgImGuiLabel& Label, FLinearColor Color /* = FLinearColor::White*/)
+{
+	ImVec4 ColorAsImVec4{Color.R, Color.G, Color.B, Color.A};
+	ImGui::TextColored(ColorAsImVec4, "%s", Label.GetUtf8());
+}
+
+bool USrgImGuiCoreLibrary::ButtonLabel(const FSrgImGuiLabel& Label)
+{
+	return ImGui::Button(Label.GetUtf8());
+}
+
+bool USrgImGuiCoreLibrary::SmallButtonLabel(const FSrgImGuiLabel& Label)
+{
+	return ImGui::SmallButton(Label.GetUtf8());
+}
+
+bool USrgImGuiCoreLibrary::ComboLabel(const FSrgImGuiLabel& Label, const TArray<FSrgImGuiLabel>& Items, int32& SelectedItemIndex)
+{
+	const int32 PreviousSelectedItemIndex = SelectedItemIndex;
+	SelectedItemIndex					  = Items.Num() > 0 ? FMath::Clamp(SelectedItemIndex, 0, Items.Num() - 1) : INDEX_NONE;
+
+	const ANSICHAR* SelectedItemLabel = Items.Num() > 0 ? Items[SelectedItemIndex].GetUtf8() : "";
+
+	if (ImGui::BeginCombo(Label.GetUtf8(), SelectedItemLabel))
+	{
+		for (int32 Index = 0; Index < Items.Num(); ++Index)
+		{
+			const bool IsSelected = Index == SelectedItemIndex;
+			if (ImGui::Selectable(Items[Index].GetUtf8(), IsSelected))
+			{
+				SelectedItemIndex = Index;
+			}
+			if (IsSelected)
+			{
+				ImGui::SetItemDefaultFocus();
+			}
+		}
+		ImGui::EndCombo();
+	}
+
+	return SelectedItemIndex != PreviousSelectedItemIndex && SelectedItemIndex != INDEX_NONE;
+}
+
+bool USrgImGuiCoreLibrary::ListLabel(const FSrgImGuiLabel& Label, const TArray<FSrgImGuiLabel>& Items, int32& SelectedItemIndex)
+{
+	const int32 PreviousSelectedItemIndex = SelectedItemIndex;
+	SelectedItemIndex					  = Items.Num() > 0 ? FMath::Clamp(SelectedItemIndex, 0, Items.Num() - 1) : INDEX_NONE;
+
+	if (ImGui::BeginListBox(Label.GetUtf8()))
+	{
+		for (int32 Index = 0; Index < Items.Num(); ++Index)
+		{
+			const bool IsSelected = Index == SelectedItemIndex;
+			if (ImGui::Selectable(Items[Index].GetUtf8(), IsSelected))
+			{
+				SelectedItemIndex = Index;
+			}
+			if (IsSelected)
+			{
+				ImGui::SetItemDefaultFocus();
+			}
+		}
+		ImGui::EndListBox();
+	}
+
+	return SelectedItemIndex != PreviousSelectedItemIndex && SelectedItemIndex != INDEX_NONE;
+}
@@ -0,0 +1,278 @@
+// © Surgent Studios
+
+#include "Library/SrgImGuiFilteredList.h"
+
+#include <imgui.h>
+
+#include "SrgImGuiMemory.h"
+#include "SrgImGuiStats.h"
+
+namespace SrgImGuiFilteredList_Private
+{
+	// Caches of widgets that were not drawn for this many frames are freed.
+	static constexpr uint64 CACHE_LIFETIME_FRAMES = 120;
+	// Typing after this long starts a new type-ahead search.
+	static constexpr double TYPE_AHEAD_TIMEOUT_SECONDS = 1.0;
+	static constexpr int32 COMBO_HEIGHT_IN_ITEMS	   = 12;
+
+	struct FItemCache
+	{
+		uint64 LastUsedFrame = 0;
+
+		// Identifies the items the cache was built from.
+		int32 NumItems	 = INDEX_NONE;
+		uint32 ItemsHash = 0;
+
+		// Every item as a null terminated UTF-8 string, back to back.
+		TArray<ANSICHAR> Utf8;
+		TArray<int32> ItemOffsets;
+
+		ImGuiTextFilter Filter;
+		// The indices of the items that pass the filter.
+		TArray<int32> FilteredItems;
+
+		FString TypeAhead;
+		double LastTypeAheadTime = 0.0;
+
+		const ANSICHAR* GetItem(int32 Index) const { return Utf8.GetData() + ItemOffsets[Index]; }
+
+		SIZE_T GetAllocatedSize() const
+		{
+			return sizeof(FItemCache) + Utf8.GetAllocatedSize() + ItemOffsets.GetAllocatedSize() +
+				   FilteredItems.GetAllocatedSize() + TypeAhead.GetAllocatedSize() + Filter.Filters.size_in_bytes();
+		}
+	};
+
+	// Only accessed from the game thread. The filters point into their own input buffer, so the caches must not move.
+	static TMap<ImGuiID, TUniquePtr<FItemCache>> ItemCaches;
+	static uint64 LastEvictionFrame = 0;
+
+	uint32 HashItems(TConstArrayView<FString> Items)
+	{
+		uint32 Hash = 0;
+		for (const FString& Item : Items)
+		{
+			Hash = FCrc::StrCrc32(*Item, HashCombineFast(Hash, Item.Len()));
+		}
+		return Hash;
+	}
+
+	void RebuildFilteredItems(FItemCache& Cache)
+	{
+		Cache.FilteredItems.Reset(Cache.NumItems);
+		for (int32 Index = 0; Index < Cache.NumItems; ++Index)
+		{
+			if (!Cache.Filter.IsActive() || Cache.Filter.PassFilter(Cache.GetItem(Index)))
+			{
+				Cache.FilteredItems.Add(Index);
+			}
+		}
+	}
+
+	FItemCache& FindOrAddCache(ImGuiID Id, TConstArrayView<FString> Items)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+
+		if (LastEvictionFrame != GFrameCounter)
+		{
+			LastEvictionFrame = GFrameCounter;
+			for (auto It = ItemCaches.CreateIterator(); It; ++It)
+			{
+				if (It->Value->LastUsedFrame + CACHE_LIFETIME_FRAMES < GFrameCounter)
+				{
+					It.RemoveCurrent();
+				}
+			}
+		}
+
+		TUniquePtr<FItemCache>& CachePtr = ItemCaches.FindOrAdd(Id);
+		if (!CachePtr)
+		{
+			CachePtr = MakeUnique<FItemCache>();
+		}
+		FItemCache& Cache	= *CachePtr;
+		Cache.LastUsedFrame = GFrameCounter;
+
+		const uint32 ItemsHash = HashItems(Items);
+		if (Cache.NumItems != Items.Num() || Cache.ItemsHash != ItemsHash)
+		{
+			Cache.NumItems	= Items.Num();
+			Cache.ItemsHash = ItemsHash;
+			Cache.Utf8.Reset();
+			Cache.ItemOffsets.Reset(Items.Num());
+			for (const FString& Item : Items)
+			{
+				SrgImGuiStats::CountStringConversion();
+				const FTCHARToUTF8 Converted(*Item);
+				Cache.ItemOffsets.Add(Cache.Utf8.Num());
+				Cache.Utf8.Append(reinterpret_cast<const ANSICHAR*>(Converted.Get()), Converted.Length());
+				Cache.Utf8.Add('\0');
+			}
+			RebuildFilteredItems(Cache);
+		}
+		return Cache;
+	}
+
+	void DrawFilter(FItemCache& Cache, float Width)
+	{
+		ImGui::SetNextItemWidth(Width);
+		if (ImGui::InputTextWithHint("##Filter", "Filter (inc,-exc)", Cache.Filter.InputBuf, IM_ARRAYSIZE(Cache.Filter.InputBuf)))
+		{
+			Cache.Filter.Build();
+			RebuildFilteredItems(Cache);
+		}
+	}
+
+	// Returns the first filtered item starting with the text typed while the current window is focused, or INDEX_NONE.
+	int32 UpdateTypeAhead(FItemCache& Cache)
+	{
+		const ImGuiIO& IO = ImGui::GetIO();
+		if (!ImGui::IsWindowFocused() || ImGui::IsAnyItemActive() || IO.InputQueueCharacters.empty())
+		{
+			return INDEX_NONE;
+		}
+
+		const double Time = ImGui::GetTime();
+		if (Time - Cache.LastTypeAheadTime > TYPE_AHEAD_TIMEOUT_SECONDS)
+		{
+			Cache.TypeAhead.Reset();
+		}
+		Cache.LastTypeAheadTime = Time;
+		for (const ImWchar Character : IO.InputQueueCharacters)
+		{
+			if (Character >= ' ')
+			{
+				Cache.TypeAhead.AppendChar(static_cast<TCHAR>(Character));
+			}
+		}
+
+		const FTCHARToUTF8 TypeAhead(*Cache.TypeAhead);
+		const ANSICHAR* TypeAheadText = reinterpret_cast<const ANSICHAR*>(TypeAhead.Get());
+		for (int32 Position = 0; Position < Cache.FilteredItems.Num(); ++Position)
+		{
+			if (FCStringAnsi::Strnicmp(Cache.GetItem(Cache.FilteredItems[Position]), TypeAheadText, TypeAhead.Length()) == 0)
+			{
+				return Position;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	// Draws the filtered items in the current window, clipped to the visible ones. Returns true if an item was clicked.
+	bool DrawItems(FItemCache& Cache, int32& SelectedItemIndex)
+	{
+		const float ItemHeight = ImGui::GetTextLineHeightWithSpacing();
+
+		const int32 TypeAheadPosition = UpdateTypeAhead(Cache);
+		if (TypeAheadPosition != INDEX_NONE)
+		{
+			SelectedItemIndex = Cache.FilteredItems[TypeAheadPosition];
+			ImGui::SetScrollY(FMath::Max(0.0f, TypeAheadPosition * ItemHeight - ImGui::GetWindowHeight() * 0.5f));
+		}
+
+		bool Clicked = false;
+		ImGuiListClipper Clipper;
+		Clipper.Begin(Cache.FilteredItems.Num(), ItemHeight);
+		while (Clipper.Step())
+		{
+			for (int32 Position = Clipper.DisplayStart; Position < Clipper.DisplayEnd; ++Position)
+			{
+				const int32 Index	  = Cache.FilteredItems[Position];
+				const bool IsSelected = Index == SelectedItemIndex;
+				ImGui::PushID(Index);
+				if (ImGui::Selectable(Cache.GetItem(Index), IsSelected))
+				{
+					SelectedItemIndex = Index;
+					Clicked			  = true;
+				}
+				if (IsSelected)
+				{
+					ImGui::SetItemDefaultFocus();
+				}
+				ImGui::PopID();
+			}
+		}
+		return Clicked;
+	}
+
+	static SrgImGuiMemory::FAutoRegisterGatherer ItemCachesGatherer(
+		[](SrgImGuiMemory::FReport& Report)
+		{
+			SIZE_T Size = ItemCaches.GetAllocatedSize();
+			for (const TPair<ImGuiID, TUniquePtr<FItemCache>>& Pair : ItemCaches)
+			{
+				Size += Pair.Value->GetAllocatedSize();
+			}
+			Report.Add(SrgImGuiMemory::Category::ItemCaches, Size, ItemCaches.Num());
+		});
+}	 // namespace SrgImGuiFilteredList_Private
+
+bool SrgImGuiFilteredList::Combo(const TCHAR* Label, TConstArrayView<FString> Items, int32& SelectedItemIndex)
+{
+	using namespace SrgImGuiFilteredList_Private;
+
+	const int32 PreviousSelectedItemIndex = SelectedItemIndex;
+	SelectedItemIndex					  = Items.Num() > 0 ? FMath::Clamp(SelectedItemIndex, 0, Items.Num() - 1) : INDEX_NONE;
+
+	const auto LabelString	 = StringCast<UTF8CHAR>(Label);
+	const char* LabelText	 = reinterpret_cast<const char*>(LabelString.Get());
+	const auto PreviewString = StringCast<UTF8CHAR>(Items.Num() > 0 ? *Items[SelectedItemIndex] : TEXT(""));
+	SrgImGuiStats::CountStringConversion();
+
+	// The ID of the combo box, which is only known in the window of the combo box.
+	const ImGuiID CacheId = ImGui::GetID(LabelText);
+	if (ImGui::BeginCombo(LabelText, reinterpret_cast<const char*>(PreviewString.Get()), ImGuiComboFlags_HeightLargest))
+	{
+		FItemCache& Cache = FindOrAddCache(CacheId, Items);
+		if (ImGui::IsWindowAppearing())
+		{
+			ImGui::SetKeyboardFocusHere();
+		}
+		DrawFilter(Cache, -FLT_MIN);
+
+		const int32 NumVisibleItems = FMath::Clamp(Cache.FilteredItems.Num(), 1, COMBO_HEIGHT_IN_ITEMS);
+		const float ItemsHeight		= NumVisibleItems * ImGui::GetTextLineHeightWithSpacing();
+		bool Clicked				= false;
+		if (ImGui::BeginChild("##Items", ImVec2(0.0f, ItemsHeight)))
+		{
+			Clicked = DrawItems(Cache, SelectedItemIndex);
+		}
+		ImGui::EndChild();
+
+		// Selectables only close the popup they are directly in, and the items are in a child window.
+		if (Clicked)
+		{
+			ImGui::CloseCurrentPopup();
+		}
+		ImGui::EndCombo();
+	}
+
+	return SelectedItemIndex != PreviousSelectedItemIndex && SelectedItemIndex != INDEX_NONE;
+}
+
+bool SrgImGuiFilteredList::List(const TCHAR* Label, TConstArrayView<FString> Items, int32& SelectedItemIndex)
+{
+	using namespace SrgImGuiFilteredList_Private;
+
+	const int32 PreviousSelectedItemIndex = SelectedItemIndex;
+	SelectedItemIndex					  = Items.Num() > 0 ? FMath::Clamp(SelectedItemIndex, 0, Items.Num() - 1) : INDEX_NONE;
+
+	const auto LabelString = StringCast<UTF8CHAR>(Label);
+	const char* LabelText  = reinterpret_cast<const char*>(LabelString.Get());
+
+	FItemCache& Cache = FindOrAddCache(ImGui::GetID(LabelText), Items);
+
+	ImGui::BeginGroup();
+	ImGui::PushID(LabelText);
+	DrawFilter(Cache, ImGui::CalcItemWidth());
+	ImGui::PopID();
+
+	if (ImGui::BeginListBox(LabelText))
+	{
+		DrawItems(Cache, SelectedItemIndex);
+		ImGui::EndListBox();
+	}
+	ImGui::EndGroup();
+
+	return SelectedItemIndex != PreviousSelectedItemIndex && SelectedItemIndex != INDEX_NONE;
+}
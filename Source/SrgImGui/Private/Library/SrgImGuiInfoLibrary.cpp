@@ -6,6 +6,7 @@
 
 #include "ImGuiModule.h"
 
+#include "SrgImGuiMemory.h"
 #include "SrgImGuiSettings.h"
 #include "SrgImGuiStringConversion.h"
 #include "SrgImGuiSubsystem.h"
@@ -15,6 +16,8 @@ bool USrgImGuiInfoLibrary::OpenCustomDrawerDemo = false;
 bool USrgImGuiInfoLibrary::OpenCoreDemo			= false;
 TWeakObjectPtr<UObject> USrgImGuiInfoLibrary::CustomDrawerExample;
 
+static SrgImGuiMemory::FAutoRegisterGatherer InfoLibraryMemoryGatherer(&USrgImGuiInfoLibrary::GatherMemoryReport);
+
 void USrgImGuiInfoLibrary::DrawAllInfo(const UObject* WorldContextObject, bool DrawUsageOutsideTree /* = true*/)
 {
 	if (DrawUsageOutsideTree)
@@ -433,6 +436,7 @@ void USrgImGuiInfoLibrary::DrawCustomDrawerDemo()
 		static FSoftClassPath SoftCustomDrawerExampleClass(
 			TEXT("/SrgImGui/BP_SrgImGui_CustomDrawerExample.BP_SrgImGui_CustomDrawerExample_C"));
 
+		SRG_IMGUI_LLM_SCOPE();
 		UClass* CustomDrawerExampleClass = SoftCustomDrawerExampleClass.TryLoadClass<UObject>();
 		CustomDrawerExample				 = NewObject<UObject>(GetTransientPackage(), CustomDrawerExampleClass);
 		CustomDrawerExample->AddToRoot();
@@ -446,6 +450,15 @@ void USrgImGuiInfoLibrary::DrawCustomDrawerDemo()
 #endif
 }
 
+void USrgImGuiInfoLibrary::GatherMemoryReport(SrgImGuiMemory::FReport& Report)
+{
+	if (CustomDrawerExample.IsValid())
+	{
+		Report.Add(SrgImGuiMemory::Category::DemoObjects,
+				   CustomDrawerExample->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal), 1);
+	}
+}
+
 void USrgImGuiInfoLibrary::DrawDebugDrawTreeInfo(const UObject* WorldContextObject)
 {
 	USrgImGuiSubsystem* Subsystem = USrgImGuiSubsystem::Get(WorldContextObject);
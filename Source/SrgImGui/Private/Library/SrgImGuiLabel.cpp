@@ -0,0 +1,21 @@
+// © Surgent Studios
+
+#include "Library/SrgImGuiLabel.h"
+
+#include "SrgImGuiStats.h"
+
+FSrgImGuiLabel::FSrgImGuiLabel(const FString& InText)
+	: Text(InText)
+{
+	Encode();
+}
+
+void FSrgImGuiLabel::Encode() const
+{
+	SrgImGuiStats::CountStringConversion();
+	const FTCHARToUTF8 Converted(*Text);
+	Utf8.Reset(Converted.Length() + 1);
+	Utf8.Append(reinterpret_cast<const ANSICHAR*>(Converted.Get()), Converted.Length());
+	Utf8.Add('\0');
+	Id = FCrc::MemCrc32(Utf8.GetData(), Converted.Length());
+}
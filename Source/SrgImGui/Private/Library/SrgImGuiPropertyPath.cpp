@@ -0,0 +1,520 @@
+// © Surgent Studios
+
+#include "Library/SrgImGuiPropertyPath.h"
+
+#include "SrgImGuiMemory.h"
+
+// A property path compiled against the class of the object it was last resolved on.
+struct FSrgImGuiCompiledPropertyPath
+{
+	struct FSegment
+	{
+		FString Name;
+		// The text between brackets, if any.
+		FString Key;
+		bool HasKey = false;
+	};
+
+	enum class EStepType : uint8
+	{
+		Object,
+		ArrayElement,
+		SetElement,
+		MapValue
+	};
+
+	// A key imported from the text of the path, for map lookups.
+	struct FMapKey
+	{
+		explicit FMapKey(const FProperty& InProperty)
+			: Property(InProperty)
+			, Owner(InProperty.GetOwnerStruct())
+			, OwnerProperties(InProperty.GetOwnerStruct() ? InProperty.GetOwnerStruct()->ChildProperties : nullptr)
+			, Data(FMemory::Malloc(InProperty.GetSize(), InProperty.GetMinAlignment()))
+		{
+			Property.InitializeValue(Data);
+		}
+
+		~FMapKey()
+		{
+			// The property is gone with its owner or with the properties of its owner (e.g. a recompiled Blueprint or user
+			// defined struct), so the value can only be freed.
+			const UStruct* OwnerStruct = Owner.Get();
+			if (OwnerStruct && OwnerStruct->ChildProperties == OwnerProperties)
+			{
+				Property.DestroyValue(Data);
+			}
+			FMemory::Free(Data);
+		}
+
+		UE_NONCOPYABLE(FMapKey);
+
+		const FProperty& Property;
+		TWeakObjectPtr<const UStruct> Owner;
+		const FField* OwnerProperties = nullptr;
+		void* Data					  = nullptr;
+	};
+
+	// Moves from the memory of an object or container element to the memory of the next one.
+	struct FStep
+	{
+		EStepType Type = EStepType::Object;
+		// From the current memory to the value of Property (an object, array, set or map property).
+		int32 ValueOffset	= 0;
+		FProperty* Property = nullptr;
+		// The element of arrays and sets.
+		int32 Index = 0;
+		// The class the rest of the path was compiled for. The path is compiled again if the object is not one.
+		TWeakObjectPtr<UClass> Class;
+		TSharedPtr<FMapKey> Key;
+		// The pair of the map the key was last found at.
+		int32 PairIndex = INDEX_NONE;
+	};
+
+	enum class EResolveResult : uint8
+	{
+		Resolved,
+		Missing,
+		Recompile
+	};
+
+	bool NeedsCompile(const UObject& Object) const
+	{
+		return Parsed && (CompiledClass != Object.GetClass() || !IsUpToDate());
+	}
+
+	bool IsUpToDate() const
+	{
+		for (const TPair<TWeakObjectPtr<const UStruct>, const FField*>& Pair : Dependencies)
+		{
+			const UStruct* Dependency = Pair.Key.Get();
+			if (!Dependency || Dependency->ChildProperties != Pair.Value)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void AddDependency(const UStruct& Struct)
+	{
+		// The properties of super structs are found through the struct too.
+		for (const UStruct* Dependency = &Struct; Dependency; Dependency = Dependency->GetSuperStruct())
+		{
+			Dependencies.Add(Dependency, Dependency->ChildProperties);
+		}
+	}
+
+	SIZE_T GetAllocatedSize() const
+	{
+		SIZE_T Size = Segments.GetAllocatedSize() + Steps.GetAllocatedSize() + Dependencies.GetAllocatedSize() +
+					  Error.GetAllocatedSize();
+		for (const FSegment& Segment : Segments)
+		{
+			Size += Segment.Name.GetAllocatedSize() + Segment.Key.GetAllocatedSize();
+		}
+		for (const FStep& Step : Steps)
+		{
+			Size += Step.Key ? sizeof(FMapKey) + Step.Key->Property.GetSize() : 0;
+		}
+		return Size;
+	}
+
+	bool Parse(const FString& Path);
+	void Compile(UObject& Object);
+	EResolveResult Resolve(UObject& Object, FSrgImGuiPropertyValue& OutValue);
+
+	TArray<FSegment> Segments;
+	bool Parsed = false;
+
+	TArray<FStep> Steps;
+	TWeakObjectPtr<UClass> CompiledClass;
+	// The property the path leads to, and where it lives from the memory the last step leads to.
+	FProperty* Leaf			  = nullptr;
+	int32 LeafContainerOffset = 0;
+	int32 LeafArrayIndex	  = 0;
+	// Set when compiling failed past an object or element that was missing, whose class could have had the property. The
+	// steps then end at the missing one, and the path is compiled again once they resolve.
+	bool CompileWhenFound = false;
+	// The structs the path was looked up in, and their first property when it was compiled. The path is compiled again if one
+	// is gone or had its properties replaced (e.g. a user defined struct recompiled in place), as the steps point at those
+	// properties.
+	TMap<TWeakObjectPtr<const UStruct>, const FField*> Dependencies;
+
+	FString Error;
+};
+
+bool FSrgImGuiCompiledPropertyPath::Parse(const FString& Path)
+{
+	Segments.Reset();
+	Parsed = false;
+
+	if (Path.IsEmpty() || Path.EndsWith(TEXT(".")))
+	{
+		Error = TEXT("A property name is missing.");
+		return false;
+	}
+
+	int32 Position = 0;
+	while (Position < Path.Len())
+	{
+		int32 End = Position;
+		while (End < Path.Len() && Path[End] != TEXT('.') && Path[End] != TEXT('['))
+		{
+			++End;
+		}
+
+		FSegment& Segment = Segments.AddDefaulted_GetRef();
+		Segment.Name	  = Path.Mid(Position, End - Position).TrimStartAndEnd();
+		if (Segment.Name.IsEmpty())
+		{
+			Error = TEXT("A property name is missing.");
+			return false;
+		}
+
+		// Keys can contain dots (e.g. floats), so brackets are read up to their end.
+		if (End < Path.Len() && Path[End] == TEXT('['))
+		{
+			const int32 KeyEnd = Path.Find(TEXT("]"), ESearchCase::CaseSensitive, ESearchDir::FromStart, End + 1);
+			if (KeyEnd == INDEX_NONE)
+			{
+				Error = FString::Printf(TEXT("The bracket after %s is not closed."), *Segment.Name);
+				return false;
+			}
+			Segment.Key	   = Path.Mid(End + 1, KeyEnd - End - 1).TrimStartAndEnd();
+			Segment.HasKey = true;
+			End			   = KeyEnd + 1;
+			if (End < Path.Len() && Path[End] != TEXT('.'))
+			{
+				Error = FString::Printf(TEXT("%s[%s] must be followed by a dot."), *Segment.Name, *Segment.Key);
+				return false;
+			}
+		}
+
+		// Skips the dot.
+		Position = End + 1;
+	}
+
+	Parsed = true;
+	return true;
+}
+
+void FSrgImGuiCompiledPropertyPath::Compile(UObject& Object)
+{
+	SRG_IMGUI_LLM_SCOPE();
+
+	Steps.Reset();
+	Dependencies.Reset();
+	CompiledClass = Object.GetClass();
+	Leaf			 = nullptr;
+	CompileWhenFound = false;
+
+	// The memory the offsets are relative to, while the objects and elements on the way exist. The classes of the objects
+	// found are used over the declared ones, so that the properties of their child classes can be reached.
+	uint8* Memory		  = reinterpret_cast<uint8*>(&Object);
+	const UStruct* Struct = Object.GetClass();
+	int32 ContainerOffset = 0;
+	// The property whose value the next segment is read from, and where that value lives.
+	FProperty* Current	= nullptr;
+	int32 CurrentOffset = 0;
+	// The step whose object or element was missing, if any.
+	int32 MissingStep = INDEX_NONE;
+
+	for (const FSegment& Segment : Segments)
+	{
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Current))
+		{
+			Struct			= StructProperty->Struct;
+			ContainerOffset = CurrentOffset;
+		}
+		else if (FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Current))
+		{
+			UObject* Value = Memory ? ObjectProperty->GetObjectPropertyValue(Memory + CurrentOffset) : nullptr;
+			UClass* Class  = Value ? Value->GetClass() : ObjectProperty->PropertyClass.Get();
+
+			FStep& Step		 = Steps.AddDefaulted_GetRef();
+			Step.Type		 = EStepType::Object;
+			Step.ValueOffset = CurrentOffset;
+			Step.Property	 = ObjectProperty;
+			Step.Class		 = Class;
+
+			if (Memory && !Value)
+			{
+				MissingStep = Steps.Num() - 1;
+			}
+			Memory			= reinterpret_cast<uint8*>(Value);
+			Struct			= Class;
+			ContainerOffset = 0;
+		}
+		else if (Current)
+		{
+			Error = FString::Printf(TEXT("%s is not a struct or an object."), *Current->GetAuthoredName());
+			return;
+		}
+
+		if (Struct)
+		{
+			AddDependency(*Struct);
+		}
+		FProperty* Property = Struct ? FSrgImGuiPropertyPath::FindPropertyByName(*Struct, Segment.Name) : nullptr;
+		if (!Property)
+		{
+			Error = FString::Printf(TEXT("%s has no property %s."), Struct ? *Struct->GetName() : TEXT("None"), *Segment.Name);
+			if (MissingStep != INDEX_NONE)
+			{
+				Steps.SetNum(MissingStep + 1);
+				CompileWhenFound = true;
+			}
+			return;
+		}
+
+		Current				= Property;
+		CurrentOffset		= ContainerOffset + Property->GetOffset_ForInternal();
+		LeafContainerOffset = ContainerOffset;
+		LeafArrayIndex		= 0;
+		if (!Segment.HasKey)
+		{
+			continue;
+		}
+
+		FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property);
+		FSetProperty* SetProperty	  = CastField<FSetProperty>(Property);
+		FMapProperty* MapProperty	  = CastField<FMapProperty>(Property);
+		int32 Index					  = INDEX_NONE;
+		if (!MapProperty && (!LexTryParseString(Index, *Segment.Key) || Index < 0))
+		{
+			Error = FString::Printf(TEXT("%s is not a valid index of %s."), *Segment.Key, *Segment.Name);
+			return;
+		}
+
+		if (Property->ArrayDim > 1)
+		{
+			if (Index >= Property->ArrayDim)
+			{
+				Error = FString::Printf(TEXT("%s only has %d elements."), *Segment.Name, Property->ArrayDim);
+				return;
+			}
+			CurrentOffset += Index * (Property->GetSize() / Property->ArrayDim);
+			LeafArrayIndex = Index;
+			continue;
+		}
+
+		FStep& Step		 = Steps.AddDefaulted_GetRef();
+		Step.ValueOffset = CurrentOffset;
+		Step.Property	 = Property;
+		Step.Index		 = Index;
+
+		const bool HadMemory = Memory != nullptr;
+		if (ArrayProperty)
+		{
+			Step.Type = EStepType::ArrayElement;
+			if (Memory)
+			{
+				FScriptArrayHelper Helper(ArrayProperty, Memory + CurrentOffset);
+				Memory = Helper.IsValidIndex(Index) ? Helper.GetRawPtr(Index) : nullptr;
+			}
+			Current = ArrayProperty->Inner;
+		}
+		else if (SetProperty)
+		{
+			Step.Type = EStepType::SetElement;
+			if (Memory)
+			{
+				FScriptSetHelper Helper(SetProperty, Memory + CurrentOffset);
+				const int32 InternalIndex = Helper.FindInternalIndex(Index);
+				Memory					  = InternalIndex != INDEX_NONE ? Helper.GetElementPtr(InternalIndex) : nullptr;
+			}
+			Current = SetProperty->ElementProp;
+		}
+		else if (MapProperty)
+		{
+			TSharedRef<FMapKey> Key = MakeShared<FMapKey>(*MapProperty->KeyProp);
+			if (!MapProperty->KeyProp->ImportText_Direct(*Segment.Key, Key->Data, nullptr, PPF_None))
+			{
+				Steps.Pop();
+				Error = FString::Printf(TEXT("%s is not a valid key of %s."), *Segment.Key, *Segment.Name);
+				return;
+			}
+
+			Step.Type = EStepType::MapValue;
+			Step.Key  = Key;
+			if (Memory)
+			{
+				FScriptMapHelper Helper(MapProperty, Memory + CurrentOffset);
+				Step.PairIndex = Helper.FindMapIndexWithKey(Key->Data);
+				Memory		   = Step.PairIndex != INDEX_NONE ? Helper.GetPairPtr(Step.PairIndex) : nullptr;
+			}
+			Current = MapProperty->ValueProp;
+		}
+		else
+		{
+			Steps.Pop();
+			Error = FString::Printf(TEXT("%s is not an array, a set or a map."), *Segment.Name);
+			return;
+		}
+
+		if (HadMemory && !Memory)
+		{
+			MissingStep = Steps.Num() - 1;
+		}
+
+		// The value of the element lives in the memory the step leads to.
+		CurrentOffset		= Current->GetOffset_ForInternal();
+		LeafContainerOffset = 0;
+	}
+
+	Leaf = Current;
+}
+
+FSrgImGuiCompiledPropertyPath::EResolveResult FSrgImGuiCompiledPropertyPath::Resolve(UObject& Object,
+																					   FSrgImGuiPropertyValue& OutValue)
+{
+	uint8* Memory = reinterpret_cast<uint8*>(&Object);
+	for (FStep& Step : Steps)
+	{
+		void* ValuePtr = Memory + Step.ValueOffset;
+		switch (Step.Type)
+		{
+		case EStepType::Object:
+		{
+			UObject* Value = static_cast<FObjectPropertyBase*>(Step.Property)->GetObjectPropertyValue(ValuePtr);
+			if (!Value)
+			{
+				Error = FString::Printf(TEXT("%s is None."), *Step.Property->GetAuthoredName());
+				return EResolveResult::Missing;
+			}
+			const UClass* Class = Step.Class.Get();
+			if (!Class || !Value->IsA(Class))
+			{
+				return EResolveResult::Recompile;
+			}
+			Memory = reinterpret_cast<uint8*>(Value);
+			break;
+		}
+		case EStepType::ArrayElement:
+		{
+			FScriptArrayHelper Helper(static_cast<FArrayProperty*>(Step.Property), ValuePtr);
+			if (!Helper.IsValidIndex(Step.Index))
+			{
+				Error = FString::Printf(TEXT("%s has no element %d."), *Step.Property->GetAuthoredName(), Step.Index);
+				return EResolveResult::Missing;
+			}
+			Memory = Helper.GetRawPtr(Step.Index);
+			break;
+		}
+		case EStepType::SetElement:
+		{
+			FScriptSetHelper Helper(static_cast<FSetProperty*>(Step.Property), ValuePtr);
+			const int32 InternalIndex = Helper.FindInternalIndex(Step.Index);
+			if (InternalIndex == INDEX_NONE)
+			{
+				Error = FString::Printf(TEXT("%s has no element %d."), *Step.Property->GetAuthoredName(), Step.Index);
+				return EResolveResult::Missing;
+			}
+			Memory = Helper.GetElementPtr(InternalIndex);
+			break;
+		}
+		case EStepType::MapValue:
+		{
+			// The pair the key was last found at is checked first, so the key is only hashed when the map changed.
+			FScriptMapHelper Helper(static_cast<FMapProperty*>(Step.Property), ValuePtr);
+			if (!Helper.IsValidIndex(Step.PairIndex) ||
+				!Step.Key->Property.Identical(Helper.GetKeyPtr(Step.PairIndex), Step.Key->Data))
+			{
+				Step.PairIndex = Helper.FindMapIndexWithKey(Step.Key->Data);
+			}
+			if (Step.PairIndex == INDEX_NONE)
+			{
+				Error = FString::Printf(TEXT("%s has no such key."), *Step.Property->GetAuthoredName());
+				return EResolveResult::Missing;
+			}
+			Memory = Helper.GetPairPtr(Step.PairIndex);
+			break;
+		}
+		}
+	}
+
+	// The object or element that was missing when compiling now exists.
+	if (!Leaf)
+	{
+		return EResolveResult::Recompile;
+	}
+
+	OutValue.ContainerPtr = Memory + LeafContainerOffset;
+	OutValue.Property	  = Leaf;
+	OutValue.ArrayIndex	  = LeafArrayIndex;
+	Error.Reset();
+	return EResolveResult::Resolved;
+}
+
+FSrgImGuiPropertyPath::FSrgImGuiPropertyPath(const FString& InPath)
+	: Path(InPath)
+{
+}
+
+FSrgImGuiPropertyValue FSrgImGuiPropertyPath::Resolve(UObject* Object) const
+{
+	using EResolveResult = FSrgImGuiCompiledPropertyPath::EResolveResult;
+
+	if (!Compiled)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+		Compiled = MakeShared<FSrgImGuiCompiledPropertyPath>();
+		Compiled->Parse(Path);
+	}
+
+	FSrgImGuiPropertyValue Value;
+	if (!Object)
+	{
+		Compiled->Error = TEXT("The object is None.");
+		return Value;
+	}
+
+	if (Compiled->NeedsCompile(*Object))
+	{
+		Compiled->Compile(*Object);
+	}
+	if (!Compiled->Leaf && !Compiled->CompileWhenFound)
+	{
+		return Value;
+	}
+
+	// An object on the way is no longer of the class the path was compiled for.
+	if (Compiled->Resolve(*Object, Value) == EResolveResult::Recompile)
+	{
+		Compiled->Compile(*Object);
+		if (Compiled->Leaf && Compiled->Resolve(*Object, Value) == EResolveResult::Recompile)
+		{
+			Compiled->Error = TEXT("An object on the way changed while it was compiled.");
+		}
+	}
+	return Value;
+}
+
+SIZE_T FSrgImGuiPropertyPath::GetAllocatedSize() const
+{
+	return Path.GetAllocatedSize() + (Compiled ? sizeof(FSrgImGuiCompiledPropertyPath) + Compiled->GetAllocatedSize() : 0);
+}
+
+const FString& FSrgImGuiPropertyPath::GetError() const
+{
+	static const FString NoError;
+	return Compiled ? Compiled->Error : NoError;
+}
+
+FProperty* FSrgImGuiPropertyPath::FindPropertyByName(const UStruct& Struct, const FString& Name)
+{
+	if (FProperty* Property = FindFProperty<FProperty>(&Struct, *Name))
+	{
+		return Property;
+	}
+	// Properties of user defined structs have a unique suffix in their name.
+	for (TFieldIterator<FProperty> It(&Struct); It; ++It)
+	{
+		if (It->GetAuthoredName() == Name)
+		{
+			return *It;
+		}
+	}
+	return nullptr;
+}
@@ -8,6 +8,7 @@
 
 #include "SrgImGuiStringConversion.h"
 #include "Interfaces/SrgImGuiCustomDrawer.h"
+#include "Panels/SrgImGuiWatchPanel.h"
 
 bool USrgImGuiTypeLibrary::DrawBool(const FString& Name, bool& Value, bool Mutable /*= false*/)
 {
@@ -174,13 +175,81 @@ DEFINE_FUNCTION(USrgImGuiTypeLibrary::execDrawStruct_K2Node)
 	}
 }
 
-bool USrgImGuiTypeLibrary::DrawObject(const FString& Name, UObject* Object, bool HasCollapsingHeader /* = true*/)
+DEFINE_FUNCTION(USrgImGuiTypeLibrary::execDrawStruct_Planned)
+{
+	PARAM_PASSED_BY_REF(Name, FStrProperty, FString);
+
+	Stack.MostRecentPropertyAddress = nullptr;
+	Stack.StepCompiledIn<FStructProperty>(nullptr);
+	void* ValuePtr = Stack.MostRecentPropertyAddress;
+
+	P_GET_OBJECT(UScriptStruct, StructType);
+	P_GET_UBOOL(Mutable);
+	P_GET_UBOOL(HasCollapsingHeader);
+	P_FINISH;
+
+	P_NATIVE_BEGIN;
+	DrawVarStart(Name, HasCollapsingHeader);
+	*StaticCast<bool*>(RESULT_PARAM) = SrgImGuiTypeDrawer::DrawStructValue(ValuePtr, StructType, Mutable, HasCollapsingHeader);
+	DrawVarEnd();
+	P_NATIVE_END;
+}
+
+DEFINE_FUNCTION(USrgImGuiTypeLibrary::execDrawClass_Planned)
+{
+	PARAM_PASSED_BY_REF(Name, FStrProperty, FString);
+
+	Stack.MostRecentPropertyAddress = nullptr;
+	Stack.StepCompiledIn<FClassProperty>(nullptr);
+	UClass** ClassPtr			   = static_cast<UClass**>(Stack.MostRecentPropertyAddress);
+	const FProperty* ClassVariable = Stack.MostRecentProperty;
+
+	P_GET_OBJECT(UClass, MetaClass);
+	P_GET_UBOOL(Mutable);
+	P_FINISH;
+
+	P_NATIVE_BEGIN;
+	DrawVarStart(Name);
+	// Like the field name pushed by the property drawers, so that nodes with the same name tell their variables apart.
+	ImGui::PushID(ClassVariable);
+	*StaticCast<bool*>(RESULT_PARAM) = ClassPtr && SrgImGuiTypeDrawer::DrawClassValue(*ClassPtr, MetaClass, Mutable);
+	ImGui::PopID();
+	DrawVarEnd();
+	P_NATIVE_END;
+}
+
+DEFINE_FUNCTION(USrgImGuiTypeLibrary::execDrawSoftClass_Planned)
+{
+	PARAM_PASSED_BY_REF(Name, FStrProperty, FString);
+
+	Stack.MostRecentPropertyAddress = nullptr;
+	Stack.StepCompiledIn<FSoftClassProperty>(nullptr);
+	FSoftObjectPtr* SoftClassPtr	   = static_cast<FSoftObjectPtr*>(Stack.MostRecentPropertyAddress);
+	const FProperty* SoftClassVariable = Stack.MostRecentProperty;
+
+	P_GET_OBJECT(UClass, MetaClass);
+	P_GET_UBOOL(Mutable);
+	P_FINISH;
+
+	P_NATIVE_BEGIN;
+	DrawVarStart(Name);
+	// Like the field name pushed by the property drawers, so that nodes with the same name tell their variables apart.
+	ImGui::PushID(SoftClassVariable);
+	*StaticCast<bool*>(RESULT_PARAM) = SoftClassPtr && SrgImGuiTypeDrawer::DrawSoftClassValue(*SoftClassPtr, MetaClass, Mutable);
+	ImGui::PopID();
+	DrawVarEnd();
+	P_NATIVE_END;
+}
+
+bool USrgImGuiTypeLibrary::DrawObject(const FString& Name, UObject* Object, bool HasCollapsingHeader /* = true*/,
+									  bool HasSearch /* = false*/)
 {
 	bool WasModified = false;
 	DrawVarStart(Name, HasCollapsingHeader);
 	if (Object)
 	{
-		WasModified = SrgImGuiTypeDrawer::DrawObjectValue(Object, HasCollapsingHeader);
+		WasModified = SrgImGuiTypeDrawer::DrawObjectValue(Object, HasCollapsingHeader, /*ForceDrawDefault = */ false,
+														  /*ExpandHeaders = */ false, HasSearch);
 	}
 	else
 	{
@@ -340,6 +409,45 @@ DEFINE_FUNCTION(USrgImGuiTypeLibrary::execDrawMap)
 	}
 }
 
+FSrgImGuiPropertyPath USrgImGuiTypeLibrary::MakePropertyPath(const FString& Path)
+{
+	return FSrgImGuiPropertyPath(Path);
+}
+
+bool USrgImGuiTypeLibrary::DrawWatch(const FString& Name, UObject* Object, const FSrgImGuiPropertyPath& Path,
+									 bool Mutable /* = false*/, bool HasCollapsingHeader /* = true*/)
+{
+	bool WasModified = false;
+	DrawVarStart(Name, HasCollapsingHeader);
+	const FSrgImGuiPropertyValue Value = Path.Resolve(Object);
+	if (Value.IsValid())
+	{
+		WasModified = SrgImGuiTypeDrawer::DrawPropertyValue(Value.ContainerPtr, Value.Property, Mutable, HasCollapsingHeader,
+															Value.ArrayIndex);
+	}
+	else
+	{
+		ImGui::TextColored(ImVec4(1.f, 0.f, 0.f, 1.f), "%s", TO_IMGUI(*Path.GetError()));
+	}
+	DrawVarEnd();
+	return WasModified;
+}
+
+void USrgImGuiTypeLibrary::PinWatch(UObject* Object, const FString& Path, bool Mutable /* = false*/)
+{
+	SrgImGuiWatches::Pin(Object, Path, Mutable);
+}
+
+void USrgImGuiTypeLibrary::UnpinWatch(UObject* Object, const FString& Path)
+{
+	SrgImGuiWatches::Unpin(Object, Path);
+}
+
+void USrgImGuiTypeLibrary::UnpinAllWatches()
+{
+	SrgImGuiWatches::UnpinAll();
+}
+
 bool USrgImGuiTypeLibrary::DrawContainerProperty(const FString* Name, void* ContainerPtr, void* PropertyPtr,
 												 UStruct& ContainerClass, bool Mutable, bool HasCollapsingHeader,
 												 int32 ArrayIndex)
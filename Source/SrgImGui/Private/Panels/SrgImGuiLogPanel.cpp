@@ -0,0 +1,386 @@
+// © Surgent Studios
+
+#include "Panels/SrgImGuiLogPanel.h"
+
+#include <imgui.h>
+
+#include "SrgImGuiMemory.h"
+#include "SrgImGuiStats.h"
+#include "Telemetry/SrgImGuiLogCapture.h"
+
+UE_DEFINE_GAMEPLAY_TAG(TAG_SrgImGui_DrawTree_Log, "SrgImGui.DrawTree.Log");
+
+namespace SrgImGuiLogPanel_Private
+{
+	// Indices of filters that were not used recently are freed past this number.
+	static constexpr int32 MAX_CACHED_INDICES = 4;
+	// Indexing a large history for a new filter is spread over several frames so that it never causes a hitch.
+	static constexpr int32 MAX_LINES_INDEXED_PER_FRAME = 4096;
+	static constexpr int32 VISIBLE_LINES			   = 24;
+
+	// Indexed by verbosity, from Fatal (1) to VeryVerbose (7).
+	static const char* VERBOSITY_NAMES[] = {"", "Fatal", "Error", "Warning", "Display", "Log", "Verbose", "VeryVerbose"};
+
+	struct FFilter
+	{
+		ELogVerbosity::Type MaxVerbosity = ELogVerbosity::VeryVerbose;
+		// Indexed by category index. Trailing visible categories are removed so that equal filters compare equal.
+		TBitArray<> HiddenCategories;
+		FString Text;
+
+		bool IsCategoryHidden(int32 CategoryIndex) const
+		{
+			return CategoryIndex < HiddenCategories.Num() && HiddenCategories[CategoryIndex];
+		}
+
+		void SetCategoryHidden(int32 CategoryIndex, bool Hidden)
+		{
+			if (HiddenCategories.Num() <= CategoryIndex)
+			{
+				HiddenCategories.Add(false, CategoryIndex + 1 - HiddenCategories.Num());
+			}
+			HiddenCategories[CategoryIndex] = Hidden;
+			while (HiddenCategories.Num() > 0 && !HiddenCategories[HiddenCategories.Num() - 1])
+			{
+				HiddenCategories.RemoveAt(HiddenCategories.Num() - 1);
+			}
+		}
+
+		bool operator==(const FFilter& Other) const
+		{
+			return MaxVerbosity == Other.MaxVerbosity && HiddenCategories == Other.HiddenCategories && Text == Other.Text;
+		}
+
+		// Whether every line that passes this filter passes Other, so that this filter can be indexed from the index of Other.
+		bool IsRefinementOf(const FFilter& Other) const
+		{
+			// With several terms or exclusions, a longer text does not always match fewer lines.
+			const auto IsSingleTerm = [](const FString& FilterText)
+			{
+				int32 Index;
+				return !FilterText.FindChar(TEXT(','), Index) && !FilterText.TrimStart().StartsWith(TEXT("-"));
+			};
+			return MaxVerbosity == Other.MaxVerbosity && HiddenCategories == Other.HiddenCategories &&
+				   IsSingleTerm(Text) && IsSingleTerm(Other.Text) && Text.Contains(Other.Text.TrimStartAndEnd());
+		}
+	};
+
+	// The history lines that pass a filter, in order. Extended every frame with the lines captured since.
+	struct FFilterIndex
+	{
+		explicit FFilterIndex(const FFilter& InFilter)
+			: Filter(InFilter)
+			, TextFilter(TCHAR_TO_UTF8(*InFilter.Text))
+		{
+		}
+
+		FFilter Filter;
+		ImGuiTextFilter TextFilter;
+		TArray<uint64> Lines;
+		// Lines before this one were dropped from the history. They are removed in batches.
+		int32 FirstValidLine = 0;
+		// The next line of the history to test.
+		uint64 NextLine		 = 0;
+		uint64 LastUsedFrame = 0;
+		// The lines of a broader filter this index was seeded from, tested before the history from NextLine.
+		TArray<uint64> Candidates;
+		int32 NextCandidate = 0;
+
+		int32 Num() const { return Lines.Num() - FirstValidLine; }
+
+		bool PassFilter(const SrgImGuiLogCapture::FLine& Line) const
+		{
+			return Line.Verbosity <= Filter.MaxVerbosity && !Filter.IsCategoryHidden(Line.CategoryIndex) &&
+				   (!TextFilter.IsActive() || TextFilter.PassFilter(Line.Text, Line.Text + Line.Length));
+		}
+
+		void Update()
+		{
+			const uint64 FirstLine = SrgImGuiLogCapture::GetFirstLine();
+			const uint64 EndLine   = SrgImGuiLogCapture::GetEndLine();
+
+			while (FirstValidLine < Lines.Num() && Lines[FirstValidLine] < FirstLine)
+			{
+				++FirstValidLine;
+			}
+			if (FirstValidLine > Lines.Num() / 2)
+			{
+				Lines.RemoveAt(0, FirstValidLine, EAllowShrinking::No);
+				FirstValidLine = 0;
+			}
+
+			// The candidates all come before NextLine, so they are tested first to keep the lines in order.
+			int32 Budget = MAX_LINES_INDEXED_PER_FRAME;
+			for (; NextCandidate < Candidates.Num() && Budget > 0; ++NextCandidate, --Budget)
+			{
+				const uint64 LineNumber = Candidates[NextCandidate];
+				if (LineNumber >= FirstLine && PassFilter(SrgImGuiLogCapture::GetLine(LineNumber)))
+				{
+					Lines.Add(LineNumber);
+				}
+			}
+			if (NextCandidate < Candidates.Num())
+			{
+				return;
+			}
+			Candidates.Empty();
+			NextCandidate = 0;
+
+			NextLine				 = FMath::Max(NextLine, FirstLine);
+			const uint64 ScanEndLine = FMath::Min(EndLine, NextLine + Budget);
+			for (; NextLine < ScanEndLine; ++NextLine)
+			{
+				if (PassFilter(SrgImGuiLogCapture::GetLine(NextLine)))
+				{
+					Lines.Add(NextLine);
+				}
+			}
+		}
+
+		SIZE_T GetAllocatedSize() const
+		{
+			return sizeof(FFilterIndex) + Lines.GetAllocatedSize() + Candidates.GetAllocatedSize() +
+				   Filter.HiddenCategories.GetAllocatedSize() + Filter.Text.GetAllocatedSize() +
+				   TextFilter.Filters.size_in_bytes();
+		}
+	};
+
+	struct FState
+	{
+		FState()
+			: Gatherer(
+				  [this](SrgImGuiMemory::FReport& Report)
+				  {
+					  SIZE_T Size = sizeof(FState) + Indices.GetAllocatedSize();
+					  for (const TUniquePtr<FFilterIndex>& Index : Indices)
+					  {
+						  Size += Index->GetAllocatedSize();
+					  }
+					  Report.Add(SrgImGuiMemory::Category::LogCapture, Size, Indices.Num());
+				  })
+		{
+		}
+
+		FFilter Filter;
+		// Edited by the filter input box. Its text is copied to Filter when it changes.
+		ImGuiTextFilter TextFilter;
+		// The indices must not move, as their text filters point into their own buffer.
+		TArray<TUniquePtr<FFilterIndex>> Indices;
+		bool AutoScroll = true;
+
+		SrgImGuiMemory::FAutoRegisterGatherer Gatherer;
+
+		FFilterIndex& FindOrAddIndex()
+		{
+			SRG_IMGUI_LLM_SCOPE();
+
+			for (const TUniquePtr<FFilterIndex>& Index : Indices)
+			{
+				if (Index->Filter == Filter)
+				{
+					Index->LastUsedFrame = GFrameCounter;
+					return *Index;
+				}
+			}
+
+			TUniquePtr<FFilterIndex> NewIndex = MakeUnique<FFilterIndex>(Filter);
+			NewIndex->LastUsedFrame			  = GFrameCounter;
+			NewIndex->NextLine				  = SrgImGuiLogCapture::GetFirstLine();
+
+			// Typing more of a filter only needs to test the lines that passed the shorter filter.
+			for (const TUniquePtr<FFilterIndex>& Index : Indices)
+			{
+				if (Filter.IsRefinementOf(Index->Filter) && Index->Candidates.IsEmpty())
+				{
+					NewIndex->Candidates.Append(Index->Lines.GetData() + Index->FirstValidLine, Index->Num());
+					NewIndex->NextLine = Index->NextLine;
+					break;
+				}
+			}
+
+			if (Indices.Num() >= MAX_CACHED_INDICES)
+			{
+				int32 OldestIndex = 0;
+				for (int32 Index = 1; Index < Indices.Num(); ++Index)
+				{
+					if (Indices[Index]->LastUsedFrame < Indices[OldestIndex]->LastUsedFrame)
+					{
+						OldestIndex = Index;
+					}
+				}
+				Indices.RemoveAt(OldestIndex);
+			}
+			return *Indices.Add_GetRef(MoveTemp(NewIndex));
+		}
+	};
+
+	ImVec4 GetVerbosityColor(ELogVerbosity::Type Verbosity)
+	{
+		switch (Verbosity)
+		{
+		case ELogVerbosity::Fatal:
+		case ELogVerbosity::Error:
+			return ImVec4(1.0f, 0.4f, 0.4f, 1.0f);
+		case ELogVerbosity::Warning:
+			return ImVec4(1.0f, 0.85f, 0.3f, 1.0f);
+		case ELogVerbosity::Verbose:
+		case ELogVerbosity::VeryVerbose:
+			return ImGui::GetStyleColorVec4(ImGuiCol_TextDisabled);
+		default:
+			return ImGui::GetStyleColorVec4(ImGuiCol_Text);
+		}
+	}
+
+	void DrawFilters(FState& State)
+	{
+		const TArray<SrgImGuiLogCapture::FCategory>& Categories = SrgImGuiLogCapture::GetCategories();
+
+		ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8.0f);
+		if (ImGui::BeginCombo("##Verbosity", VERBOSITY_NAMES[State.Filter.MaxVerbosity]))
+		{
+			for (int32 Verbosity = ELogVerbosity::Fatal; Verbosity <= ELogVerbosity::VeryVerbose; ++Verbosity)
+			{
+				if (ImGui::Selectable(VERBOSITY_NAMES[Verbosity], Verbosity == State.Filter.MaxVerbosity))
+				{
+					State.Filter.MaxVerbosity = static_cast<ELogVerbosity::Type>(Verbosity);
+				}
+			}
+			ImGui::EndCombo();
+		}
+
+		ImGui::SameLine();
+		ImGui::SetNextItemWidth(ImGui::GetFontSize() * 10.0f);
+		const int32 NumHidden = State.Filter.HiddenCategories.CountSetBits();
+		char Preview[32];
+		FCStringAnsi::Snprintf(Preview, sizeof(Preview), NumHidden > 0 ? "%d hidden" : "All categories", NumHidden);
+		if (ImGui::BeginCombo("##Categories", Preview, ImGuiComboFlags_HeightLarge))
+		{
+			if (ImGui::SmallButton("Show All"))
+			{
+				State.Filter.HiddenCategories.Reset();
+			}
+			ImGui::SameLine();
+			if (ImGui::SmallButton("Hide All"))
+			{
+				for (int32 Index = 0; Index < Categories.Num(); ++Index)
+				{
+					State.Filter.SetCategoryHidden(Index, true);
+				}
+			}
+			for (int32 Index = 0; Index < Categories.Num(); ++Index)
+			{
+				bool Visible = !State.Filter.IsCategoryHidden(Index);
+				ImGui::PushID(Index);
+				if (ImGui::Checkbox("##Visible", &Visible))
+				{
+					State.Filter.SetCategoryHidden(Index, !Visible);
+				}
+				ImGui::SameLine();
+				ImGui::Text("%s (%d)", Categories[Index].Utf8.GetData(), Categories[Index].NumLines);
+				ImGui::PopID();
+			}
+			ImGui::EndCombo();
+		}
+
+		ImGui::SameLine();
+		ImGui::SetNextItemWidth(ImGui::GetFontSize() * 16.0f);
+		if (ImGui::InputTextWithHint("##Filter", "Filter (inc,-exc)", State.TextFilter.InputBuf,
+									 IM_ARRAYSIZE(State.TextFilter.InputBuf)))
+		{
+			SrgImGuiStats::CountStringConversion();
+			State.Filter.Text = UTF8_TO_TCHAR(State.TextFilter.InputBuf);
+		}
+
+		ImGui::SameLine();
+		ImGui::Checkbox("Auto-scroll", &State.AutoScroll);
+		ImGui::SameLine();
+		if (ImGui::Button("Clear"))
+		{
+			SrgImGuiLogCapture::Clear();
+		}
+	}
+
+	void DrawLines(FState& State, const FFilterIndex& Index)
+	{
+		const TArray<SrgImGuiLogCapture::FCategory>& Categories = SrgImGuiLogCapture::GetCategories();
+		const float LineHeight									= ImGui::GetTextLineHeightWithSpacing();
+
+		if (ImGui::BeginChild("##Lines", ImVec2(0.0f, LineHeight * VISIBLE_LINES), true,
+							  ImGuiWindowFlags_HorizontalScrollbar))
+		{
+			ImGuiListClipper Clipper;
+			Clipper.Begin(Index.Num(), LineHeight);
+			while (Clipper.Step())
+			{
+				for (int32 Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; ++Row)
+				{
+					const SrgImGuiLogCapture::FLine Line = SrgImGuiLogCapture::GetLine(Index.Lines[Index.FirstValidLine + Row]);
+					ImGui::PushStyleColor(ImGuiCol_Text, GetVerbosityColor(Line.Verbosity));
+					ImGui::Text("[%9.3f] %s:", Line.Time, Categories[Line.CategoryIndex].Utf8.GetData());
+					ImGui::SameLine();
+					ImGui::TextUnformatted(Line.Text, Line.Text + Line.Length);
+					ImGui::PopStyleColor();
+				}
+			}
+
+			if (State.AutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+			{
+				ImGui::SetScrollHereY(1.0f);
+			}
+		}
+		ImGui::EndChild();
+	}
+}	 // namespace SrgImGuiLogPanel_Private
+
+ESrgImGuiDrawTreeNodeBehavior USrgImGuiLogPanel::ImGui_DrawTreeNode_Start_Implementation(const FGameplayTag& NodeTag)
+{
+	using namespace SrgImGuiLogPanel_Private;
+
+	if (!ImGui::CollapsingHeader("Log"))
+	{
+		return ESrgImGuiDrawTreeNodeBehavior::SkipChildren;
+	}
+
+	if (!SrgImGuiLogCapture::IsCapturing())
+	{
+		ImGui::TextDisabled("The log is not being captured.");
+		return ESrgImGuiDrawTreeNodeBehavior::Continue;
+	}
+
+	if (!State.IsValid())
+	{
+		SRG_IMGUI_LLM_SCOPE();
+		State = MakePimpl<FState>();
+	}
+
+	DrawFilters(*State);
+
+	FFilterIndex& Index = State->FindOrAddIndex();
+	Index.Update();
+
+	const uint64 FirstLine = SrgImGuiLogCapture::GetFirstLine();
+	const uint64 EndLine   = SrgImGuiLogCapture::GetEndLine();
+	ImGui::Text("%d of %llu lines", Index.Num(), static_cast<unsigned long long>(EndLine - FirstLine));
+	if (Index.NextCandidate < Index.Candidates.Num())
+	{
+		ImGui::SameLine();
+		ImGui::TextDisabled("(filtering %.0f%%)", 100.0 * Index.NextCandidate / Index.Candidates.Num());
+	}
+	else if (Index.NextLine < EndLine)
+	{
+		ImGui::SameLine();
+		ImGui::TextDisabled("(filtering %.0f%%)", 100.0 * (Index.NextLine - FirstLine) / (EndLine - FirstLine));
+	}
+	if (const uint32 NumDropped = SrgImGuiLogCapture::GetNumDropped())
+	{
+		ImGui::SameLine();
+		ImGui::TextColored(ImVec4(1.0f, 0.85f, 0.3f, 1.0f), "%u lines dropped", NumDropped);
+	}
+
+	DrawLines(*State, Index);
+	return ESrgImGuiDrawTreeNodeBehavior::Continue;
+}
+
+void USrgImGuiLogPanel::ImGui_DrawTreeNode_End_Implementation(const FGameplayTag& NodeTag)
+{
+}
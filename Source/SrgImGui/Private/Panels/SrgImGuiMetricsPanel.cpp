@@ -0,0 +1,72 @@
+// © Surgent Studios
+
+#include "Panels/SrgImGuiMetricsPanel.h"
+
+#include <imgui.h>
+
+#include "SrgImGuiStringConversion.h"
+#include "Telemetry/SrgImGuiMetrics.h"
+
+UE_DEFINE_GAMEPLAY_TAG(TAG_SrgImGui_DrawTree_Metrics, "SrgImGui.DrawTree.Metrics");
+
+namespace SrgImGuiMetricsPanel_Private
+{
+	static constexpr float SPARKLINE_WIDTH	= 160.0f;
+	static constexpr float SPARKLINE_HEIGHT = 20.0f;
+}	 // namespace SrgImGuiMetricsPanel_Private
+
+ESrgImGuiDrawTreeNodeBehavior USrgImGuiMetricsPanel::ImGui_DrawTreeNode_Start_Implementation(const FGameplayTag& NodeTag)
+{
+	using namespace SrgImGuiMetricsPanel_Private;
+
+	if (!ImGui::CollapsingHeader("Metrics"))
+	{
+		return ESrgImGuiDrawTreeNodeBehavior::SkipChildren;
+	}
+
+	const TArray<SrgImGuiMetrics::FMetricSnapshot>& Snapshots = SrgImGuiMetrics::GetSnapshots();
+	if (Snapshots.IsEmpty())
+	{
+		ImGui::TextDisabled("No metrics registered.");
+		return ESrgImGuiDrawTreeNodeBehavior::Continue;
+	}
+
+	constexpr ImGuiTableFlags TableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_Resizable;
+	if (ImGui::BeginTable("Metrics", 4, TableFlags))
+	{
+		ImGui::TableSetupColumn("Name");
+		ImGui::TableSetupColumn("Value");
+		ImGui::TableSetupColumn("Rate/s");
+		ImGui::TableSetupColumn("History", ImGuiTableColumnFlags_WidthFixed, SPARKLINE_WIDTH);
+		ImGui::TableHeadersRow();
+
+		for (const SrgImGuiMetrics::FMetricSnapshot& Snapshot : Snapshots)
+		{
+			const bool IsCounter = Snapshot.Type == ESrgImGuiMetricType::Counter;
+			ImGui::PushID(&Snapshot);
+
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(TO_IMGUI(*Snapshot.Name.ToString()));
+			ImGui::TableNextColumn();
+			ImGui::Text(IsCounter ? "%.0f" : "%g", Snapshot.Value);
+			ImGui::TableNextColumn();
+			if (IsCounter)
+			{
+				ImGui::Text("%.1f", Snapshot.RatePerSecond);
+			}
+			ImGui::TableNextColumn();
+			ImGui::PlotLines("##History", Snapshot.History.GetData(), Snapshot.History.Num(), Snapshot.HistoryOffset, nullptr,
+							 FLT_MAX, FLT_MAX, ImVec2(SPARKLINE_WIDTH, SPARKLINE_HEIGHT));
+
+			ImGui::PopID();
+		}
+		ImGui::EndTable();
+	}
+
+	return ESrgImGuiDrawTreeNodeBehavior::Continue;
+}
+
+void USrgImGuiMetricsPanel::ImGui_DrawTreeNode_End_Implementation(const FGameplayTag& NodeTag)
+{
+}
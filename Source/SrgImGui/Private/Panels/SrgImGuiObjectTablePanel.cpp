@@ -0,0 +1,303 @@
+// © Surgent Studios
+
+#include "Panels/SrgImGuiObjectTablePanel.h"
+
+#include <imgui.h>
+
+#include "UObject/UObjectHash.h"
+
+#include "SrgImGuiMemory.h"
+#include "SrgImGuiStats.h"
+#include "SrgImGuiStringConversion.h"
+#include "Library/SrgImGuiFilteredList.h"
+#include "TypeDrawer/SrgImGuiTypeDrawer.h"
+#include "TypeDrawer/SrgImGuiTypeDrawer_Table.h"
+
+UE_DEFINE_GAMEPLAY_TAG(TAG_SrgImGui_DrawTree_ObjectTable, "SrgImGui.DrawTree.ObjectTable");
+
+namespace SrgImGuiObjectTablePanel_Private
+{
+	// Gathering the instances is spread over several frames so that it never causes a hitch.
+	static constexpr double GATHER_BUDGET_SECONDS = 0.001;
+	// The instances are gathered again this long after the previous gathering ended.
+	static constexpr double REFRESH_INTERVAL_SECONDS = 1.0;
+
+	struct FState
+	{
+		FState()
+			: MemoryGatherer(
+				  [this](SrgImGuiMemory::FReport& Report)
+				  {
+					  const SIZE_T Size = sizeof(FState) + Classes.GetAllocatedSize() + ClassNames.GetAllocatedSize() +
+										  SelectedProperties.GetAllocatedSize() + Plan.Columns.GetAllocatedSize() +
+										  Instances.GetAllocatedSize() + GatheredInstances.GetAllocatedSize() +
+										  GatherClasses.GetAllocatedSize() + Sort.Order.GetAllocatedSize();
+					  Report.Add(SrgImGuiMemory::Category::ItemCaches, Size, Instances.Num());
+				  })
+		{
+		}
+
+		// Every class that can be picked, sorted by name, and their names for the class combo.
+		TArray<TWeakObjectPtr<UClass>> Classes;
+		TArray<FString> ClassNames;
+		int32 SelectedClassIndex = INDEX_NONE;
+
+		TArray<FName> SelectedProperties;
+		ImGuiTextFilter PropertyFilter;
+		SrgImGuiTypeDrawer_Private::FPropertyTablePlan Plan;
+		bool PlanDirty = true;
+
+		// The instances drawn in the table. They are replaced once the next gathering is complete.
+		TArray<TWeakObjectPtr<UObject>> Instances;
+		SrgImGuiTypeDrawer_Private::FPropertyTableSort Sort;
+
+		// The classes left to visit and the instances found so far by the current gathering.
+		TArray<TWeakObjectPtr<UClass>> GatherClasses;
+		int32 NextGatherClass = 0;
+		TArray<TWeakObjectPtr<UObject>> GatheredInstances;
+		bool Gathering		  = false;
+		double LastGatherTime = 0.0;
+		bool AutoRefresh	  = true;
+		bool CurrentWorldOnly = true;
+		bool Mutable		  = false;
+
+		SrgImGuiMemory::FAutoRegisterGatherer MemoryGatherer;
+
+		UClass* GetSelectedClass() const
+		{
+			return Classes.IsValidIndex(SelectedClassIndex) ? Classes[SelectedClassIndex].Get() : nullptr;
+		}
+	};
+
+	void RefreshClasses(FState& State)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+
+		UClass* SelectedClass = State.GetSelectedClass();
+
+		TArray<UClass*> Classes;
+		Classes.Add(UObject::StaticClass());
+		GetDerivedClasses(UObject::StaticClass(), Classes);
+		Classes.RemoveAll(
+			[](const UClass* Class)
+			{
+				return Class->HasAnyClassFlags(CLASS_NewerVersionExists | CLASS_Deprecated) ||
+					   Class->GetName().StartsWith(TEXT("SKEL_")) || Class->GetName().StartsWith(TEXT("REINST_"));
+			});
+		Classes.Sort([](const UClass& A, const UClass& B) { return A.GetName() < B.GetName(); });
+
+		State.Classes.Reset(Classes.Num());
+		State.ClassNames.Reset(Classes.Num());
+		for (UClass* Class : Classes)
+		{
+			State.Classes.Add(Class);
+			State.ClassNames.Add(Class->GetName());
+		}
+		State.SelectedClassIndex = State.Classes.IndexOfByKey(SelectedClass);
+	}
+
+	void ResetInstances(FState& State)
+	{
+		State.Instances.Reset();
+		State.GatheredInstances.Reset();
+		State.GatherClasses.Reset();
+		State.Gathering		 = false;
+		State.LastGatherTime = 0.0;
+		State.PlanDirty		 = true;
+		State.Sort.Invalidate();
+	}
+
+	void StartGathering(FState& State, UClass& Class)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+
+		TArray<UClass*> Classes;
+		Classes.Add(&Class);
+		GetDerivedClasses(&Class, Classes);
+
+		State.GatherClasses.Reset(Classes.Num());
+		for (UClass* DerivedClass : Classes)
+		{
+			State.GatherClasses.Add(DerivedClass);
+		}
+		State.NextGatherClass = 0;
+		State.GatheredInstances.Reset();
+		State.Gathering = true;
+	}
+
+	// Visits the remaining classes until the time budget is spent. The instances of each class are found through the object hash
+	// of the class, instead of iterating every object.
+	void StepGathering(FState& State, const UWorld* World)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+
+		const double EndTime = FPlatformTime::Seconds() + GATHER_BUDGET_SECONDS;
+		while (State.NextGatherClass < State.GatherClasses.Num() && FPlatformTime::Seconds() < EndTime)
+		{
+			UClass* Class = State.GatherClasses[State.NextGatherClass++].Get();
+			if (!Class)
+			{
+				continue;
+			}
+
+			ForEachObjectOfClass(
+				Class,
+				[&State, World](UObject* Object)
+				{
+					if (IsValid(Object) && (!World || Object->GetWorld() == World))
+					{
+						State.GatheredInstances.Add(Object);
+					}
+				},
+				false, RF_ClassDefaultObject | RF_ArchetypeObject);
+		}
+
+		if (State.NextGatherClass >= State.GatherClasses.Num())
+		{
+			State.Instances = MoveTemp(State.GatheredInstances);
+			State.Gathering = false;
+			// The values may have changed since the rows were sorted.
+			State.Sort.Invalidate();
+			State.LastGatherTime = FPlatformTime::Seconds();
+		}
+	}
+
+	void DrawColumnPicker(FState& State, UClass& Class)
+	{
+		char Preview[32];
+		FCStringAnsi::Snprintf(Preview, sizeof(Preview), "%d columns", State.SelectedProperties.Num());
+		ImGui::SetNextItemWidth(ImGui::GetFontSize() * 10.0f);
+		if (!ImGui::BeginCombo("##Columns", Preview, ImGuiComboFlags_HeightLarge))
+		{
+			return;
+		}
+
+		State.PropertyFilter.Draw("##Filter");
+		for (TFieldIterator<FProperty> PropIt(&Class); PropIt; ++PropIt)
+		{
+			const FProperty* Property = *PropIt;
+			if (!SrgImGuiTypeDrawer_Private::FindDrawPropertyValueFunction(*Property) || Property->ArrayDim != 1)
+			{
+				continue;
+			}
+
+			// Converted once for both the filter and the checkbox.
+			SrgImGuiStats::CountStringConversion();
+			const auto Name	  = StringCast<UTF8CHAR>(*Property->GetAuthoredName());
+			const char* Label = reinterpret_cast<const char*>(Name.Get());
+			if (!State.PropertyFilter.PassFilter(Label))
+			{
+				continue;
+			}
+
+			const int32 SelectedIndex = State.SelectedProperties.IndexOfByKey(Property->GetFName());
+			bool Selected			  = SelectedIndex != INDEX_NONE;
+			if (ImGui::Checkbox(Label, &Selected))
+			{
+				if (Selected)
+				{
+					State.SelectedProperties.Add(Property->GetFName());
+				}
+				else
+				{
+					State.SelectedProperties.RemoveAt(SelectedIndex);
+				}
+				State.PlanDirty = true;
+			}
+		}
+		ImGui::EndCombo();
+	}
+}	 // namespace SrgImGuiObjectTablePanel_Private
+
+ESrgImGuiDrawTreeNodeBehavior USrgImGuiObjectTablePanel::ImGui_DrawTreeNode_Start_Implementation(const FGameplayTag& NodeTag)
+{
+	using namespace SrgImGuiObjectTablePanel_Private;
+
+	if (!ImGui::CollapsingHeader("Object Table"))
+	{
+		return ESrgImGuiDrawTreeNodeBehavior::SkipChildren;
+	}
+
+	if (!State.IsValid())
+	{
+		SRG_IMGUI_LLM_SCOPE();
+		State = MakePimpl<FState>();
+		RefreshClasses(*State);
+	}
+
+	ImGui::SetNextItemWidth(ImGui::GetFontSize() * 16.0f);
+	if (SrgImGuiFilteredList::Combo(TEXT("##Class"), State->ClassNames, State->SelectedClassIndex))
+	{
+		State->SelectedProperties.Reset();
+		ResetInstances(*State);
+	}
+	ImGui::SameLine();
+	if (ImGui::Button("Refresh Classes"))
+	{
+		RefreshClasses(*State);
+	}
+
+	UClass* Class = State->GetSelectedClass();
+	if (!Class)
+	{
+		ImGui::TextDisabled("Pick a class to list its instances.");
+		return ESrgImGuiDrawTreeNodeBehavior::Continue;
+	}
+
+	DrawColumnPicker(*State, *Class);
+	ImGui::SameLine();
+	if (ImGui::Checkbox("Current World Only", &State->CurrentWorldOnly))
+	{
+		ResetInstances(*State);
+	}
+	ImGui::SameLine();
+	ImGui::Checkbox("Auto Refresh", &State->AutoRefresh);
+	ImGui::SameLine();
+	const bool Refresh = ImGui::Button("Refresh");
+	ImGui::SameLine();
+	ImGui::Checkbox("Mutable", &State->Mutable);
+
+	if (State->PlanDirty || State->Plan.Struct != Class)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+		State->Plan		 = SrgImGuiTypeDrawer_Private::FPropertyTablePlan::Compile(*Class, State->SelectedProperties);
+		State->PlanDirty = false;
+		State->Sort.Invalidate();
+	}
+
+	const bool RefreshDue = State->AutoRefresh && FPlatformTime::Seconds() - State->LastGatherTime >= REFRESH_INTERVAL_SECONDS;
+	if (!State->Gathering && (Refresh || RefreshDue || State->LastGatherTime == 0.0))
+	{
+		StartGathering(*State, *Class);
+	}
+	if (State->Gathering)
+	{
+		StepGathering(*State, State->CurrentWorldOnly ? GetWorld() : nullptr);
+	}
+
+	ImGui::Text("%d instances", State->Instances.Num());
+	if (State->Gathering)
+	{
+		ImGui::SameLine();
+		ImGui::TextDisabled("(gathering %d/%d classes)", State->NextGatherClass, State->GatherClasses.Num());
+	}
+
+	SrgImGuiTypeDrawer_Private::FDrawingContext Context;
+	Context.Mutable = State->Mutable;
+
+	TArray<TWeakObjectPtr<UObject>>& Instances = State->Instances;
+	SrgImGuiTypeDrawer_Private::DrawPropertyTable(
+		"##Instances", State->Plan, Instances.Num(), [&Instances](int32 Row) -> void* { return Instances[Row].Get(); }, "Name",
+		[&Instances](int32 Row)
+		{
+			const UObject* Object = Instances[Row].Get();
+			ImGui::TextUnformatted(Object ? TO_IMGUI(*Object->GetName()) : "(destroyed)");
+		},
+		State->Sort, Context);
+
+	return ESrgImGuiDrawTreeNodeBehavior::Continue;
+}
+
+void USrgImGuiObjectTablePanel::ImGui_DrawTreeNode_End_Implementation(const FGameplayTag& NodeTag)
+{
+}
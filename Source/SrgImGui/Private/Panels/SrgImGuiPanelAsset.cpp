@@ -0,0 +1,599 @@
+// © Surgent Studios
+
+#include "Panels/SrgImGuiPanelAsset.h"
+
+#include <imgui.h>
+
+#include "Library/SrgImGuiLabel.h"
+#include "Library/SrgImGuiPropertyPath.h"
+#include "SrgImGuiMemory.h"
+#include "SrgImGuiStats.h"
+#include "SrgImGuiStringConversion.h"
+#include "SrgImGuiSubsystem.h"
+#include "TypeDrawer/SrgImGuiTypeDrawer.h"
+#include "UObject/Package.h"
+
+// A property path resolved against a class. Every property but the last leads to a struct, or to an object to dereference.
+struct FSrgImGuiPanelPath
+{
+	struct FStep
+	{
+		const FProperty* Property = nullptr;
+		// Set if the value of the property is an object that the next property belongs to.
+		const FObjectPropertyBase* Object = nullptr;
+	};
+
+	TArray<FStep> Steps;
+	FProperty* Leaf = nullptr;
+
+	// Casts of the leaf, resolved once so that reading the value needs no cast.
+	const FBoolProperty* Bool				  = nullptr;
+	const FNumericProperty* Numeric			  = nullptr;
+	const FObjectPropertyBase* ObjectProperty = nullptr;
+
+	bool IsSet() const { return Leaf != nullptr; }
+
+	// Returns the container of the leaf, or null if an object on the way is null.
+	void* ResolveContainer(UObject* Target) const
+	{
+		void* Container = Target;
+		for (const FStep& Step : Steps)
+		{
+			void* Value = Step.Property->ContainerPtrToValuePtr<void>(Container);
+			Container	= Step.Object ? Step.Object->GetObjectPropertyValue(Value) : Value;
+			if (!Container)
+			{
+				return nullptr;
+			}
+		}
+		return Container;
+	}
+};
+
+// The native draw program a panel asset is compiled into.
+struct FSrgImGuiPanelProgram
+{
+	struct FInstruction
+	{
+		ESrgImGuiPanelWidgetType Type = ESrgImGuiPanelWidgetType::Text;
+		FSrgImGuiLabel Label;
+		// The text around "{0}" in the format, or the label followed by a colon when there is no format.
+		FSrgImGuiLabel Prefix;
+		FSrgImGuiLabel Suffix;
+		bool HasOverlay = false;
+
+		FSrgImGuiPanelPath Value;
+		FSrgImGuiPanelPath Condition;
+		bool InvertCondition = false;
+
+		// For Begin widgets the index of their End, where drawing continues when they are closed. The opposite for End.
+		int32 MatchingIndex = INDEX_NONE;
+
+		UFunction* Function = nullptr;
+		ImVec4 Color{0.0f, 0.0f, 0.0f, 0.0f};
+		int32 Precision = 2;
+		float Min		= 0.0f;
+		float Max		= 1.0f;
+		bool Mutable	= false;
+
+		bool HasColor() const { return Color.w > 0.0f; }
+	};
+
+	// The class the paths were resolved against. The program is compiled again if the target class changes (e.g. when a
+	// Blueprint class is recompiled).
+	UClass* TargetClass = nullptr;
+	FSrgImGuiLabel Title;
+	TArray<FInstruction> Instructions;
+	TArray<FSrgImGuiLabel> Errors;
+
+	// The first property of every struct and class the paths went through. The program is compiled again if any of them is
+	// gone or had its properties replaced (e.g. a recompiled user defined struct), as the paths point at those properties.
+	TMap<TWeakObjectPtr<const UStruct>, const FField*> Dependencies;
+
+	bool IsUpToDate() const
+	{
+		for (const TPair<TWeakObjectPtr<const UStruct>, const FField*>& Pair : Dependencies)
+		{
+			const UStruct* Dependency = Pair.Key.Get();
+			if (!Dependency || Dependency->ChildProperties != Pair.Value)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void AddDependency(const UStruct& Struct)
+	{
+		// The properties of super structs are found through the struct too.
+		for (const UStruct* Dependency = &Struct; Dependency; Dependency = Dependency->GetSuperStruct())
+		{
+			Dependencies.Add(Dependency, Dependency->ChildProperties);
+		}
+	}
+};
+
+namespace SrgImGuiPanelAsset_Private
+{
+	static constexpr int32 VALUE_BUFFER_SIZE   = 64;
+	static constexpr int32 OVERLAY_BUFFER_SIZE = 256;
+
+	bool CompilePath(const FString& Path, FSrgImGuiPanelProgram& Program, FSrgImGuiPanelPath& OutPath, FString& OutError)
+	{
+		TArray<FString> Names;
+		Path.ParseIntoArray(Names, TEXT("."));
+
+		const UStruct* Struct = Program.TargetClass;
+		for (int32 Index = 0; Index < Names.Num(); ++Index)
+		{
+			if (Struct)
+			{
+				Program.AddDependency(*Struct);
+			}
+			FProperty* Property = Struct ? FSrgImGuiPropertyPath::FindPropertyByName(*Struct, Names[Index]) : nullptr;
+			if (!Property)
+			{
+				OutError = FString::Printf(TEXT("\"%s\": %s has no property %s."), *Path,
+										   Struct ? *Struct->GetName() : *Names[Index - 1], *Names[Index]);
+				return false;
+			}
+
+			if (Index == Names.Num() - 1)
+			{
+				OutPath.Leaf		   = Property;
+				OutPath.Bool		   = CastField<FBoolProperty>(Property);
+				OutPath.ObjectProperty = CastField<FObjectPropertyBase>(Property);
+				OutPath.Numeric		   = CastField<FNumericProperty>(Property);
+				if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+				{
+					OutPath.Numeric = EnumProperty->GetUnderlyingProperty();
+				}
+				break;
+			}
+
+			FSrgImGuiPanelPath::FStep& Step = OutPath.Steps.AddDefaulted_GetRef();
+			Step.Property					= Property;
+			if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				Struct = StructProperty->Struct;
+			}
+			else if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+			{
+				Step.Object = ObjectProperty;
+				Struct		= ObjectProperty->PropertyClass;
+			}
+			else
+			{
+				Struct = nullptr;
+			}
+		}
+		return true;
+	}
+
+	// Errors are logged and shown at the top of the panel. The widgets that caused them are left out.
+	void AddError(FSrgImGuiPanelProgram& Program, const UObject& Asset, int32 WidgetIndex, const FString& Error)
+	{
+		const FString Message =
+			WidgetIndex == INDEX_NONE ? Error : FString::Printf(TEXT("Widget %d: %s"), WidgetIndex, *Error);
+		UE_LOG(LogSrgImGui, Warning, TEXT("%s %s"), *Asset.GetPathName(), *Message);
+		Program.Errors.Emplace(Message);
+	}
+
+	TSharedPtr<FSrgImGuiPanelProgram> Compile(const USrgImGuiPanelAsset& Asset)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+
+		TSharedPtr<FSrgImGuiPanelProgram> Program = MakeShared<FSrgImGuiPanelProgram>();
+		Program->TargetClass					  = Asset.TargetClass.Get();
+		Program->Title							  = FSrgImGuiLabel(Asset.Title.IsEmpty() ? Asset.GetName() : Asset.Title);
+		if (!Program->TargetClass)
+		{
+			AddError(*Program, Asset, INDEX_NONE, TEXT("The panel has no target class."));
+			return Program;
+		}
+
+		TArray<int32, TInlineAllocator<16>> OpenBegins;
+		for (int32 WidgetIndex = 0; WidgetIndex < Asset.Widgets.Num(); ++WidgetIndex)
+		{
+			const FSrgImGuiPanelWidget& Widget = Asset.Widgets[WidgetIndex];
+			FSrgImGuiPanelProgram::FInstruction Instruction;
+			Instruction.Type			= Widget.Type;
+			Instruction.InvertCondition = Widget.InvertCondition;
+			Instruction.Color			= ImVec4(Widget.Color.R, Widget.Color.G, Widget.Color.B, Widget.Color.A);
+			Instruction.Precision		= FMath::Clamp(Widget.Precision, 0, 9);
+			Instruction.Min				= Widget.Min;
+			Instruction.Max				= Widget.Max;
+			Instruction.Mutable			= Widget.Mutable;
+
+			FString Error;
+			const bool UsesValue = Widget.Type == ESrgImGuiPanelWidgetType::Text ||
+								   Widget.Type == ESrgImGuiPanelWidgetType::Property ||
+								   Widget.Type == ESrgImGuiPanelWidgetType::ProgressBar;
+			if (UsesValue && !Widget.PropertyPath.IsEmpty() &&
+				!CompilePath(Widget.PropertyPath, *Program, Instruction.Value, Error))
+			{
+				AddError(*Program, Asset, WidgetIndex, Error);
+				continue;
+			}
+			// Ends are always executed so that they close their Begin.
+			if (!Widget.ConditionPath.IsEmpty() && Widget.Type != ESrgImGuiPanelWidgetType::End)
+			{
+				const bool Compiled = CompilePath(Widget.ConditionPath, *Program, Instruction.Condition, Error);
+				const FSrgImGuiPanelPath& Condition = Instruction.Condition;
+				if (Compiled && !Condition.Bool && !Condition.Numeric && !Condition.ObjectProperty)
+				{
+					Error = TEXT("Conditions must be bool, numeric or object properties.");
+				}
+				if (!Error.IsEmpty())
+				{
+					AddError(*Program, Asset, WidgetIndex, Error);
+					// Begins are kept without their condition so that the Ends still match.
+					if (Widget.Type != ESrgImGuiPanelWidgetType::BeginHeader &&
+						Widget.Type != ESrgImGuiPanelWidgetType::BeginTreeNode)
+					{
+						continue;
+					}
+					Instruction.Condition = FSrgImGuiPanelPath();
+				}
+			}
+
+			switch (Widget.Type)
+			{
+			case ESrgImGuiPanelWidgetType::Property:
+				if (!Instruction.Value.IsSet())
+				{
+					AddError(*Program, Asset, WidgetIndex, TEXT("Property widgets need a property path."));
+					continue;
+				}
+				Instruction.Label = FSrgImGuiLabel(
+					Widget.Label.IsEmpty() ? Instruction.Value.Leaf->GetAuthoredName() + TEXT(":") : Widget.Label);
+				break;
+			case ESrgImGuiPanelWidgetType::ProgressBar:
+				if (!Instruction.Value.Numeric)
+				{
+					AddError(*Program, Asset, WidgetIndex, TEXT("Progress bars need a numeric property."));
+					continue;
+				}
+				// Progress bars format their overlay like text.
+				[[fallthrough]];
+			case ESrgImGuiPanelWidgetType::Text:
+			{
+				Instruction.Label = FSrgImGuiLabel(Widget.Label);
+				FString Prefix	  = Widget.Format;
+				FString Suffix;
+				if (!Widget.Format.Split(TEXT("{0}"), &Prefix, &Suffix) && Widget.Format.IsEmpty() &&
+					Widget.Type == ESrgImGuiPanelWidgetType::Text && !Widget.Label.IsEmpty())
+				{
+					Prefix = Widget.Label + TEXT(": ");
+				}
+				Instruction.Prefix	   = FSrgImGuiLabel(Prefix);
+				Instruction.Suffix	   = FSrgImGuiLabel(Suffix);
+				Instruction.HasOverlay = !Widget.Format.IsEmpty();
+				break;
+			}
+			case ESrgImGuiPanelWidgetType::Button:
+				Instruction.Label	 = FSrgImGuiLabel(Widget.Label.IsEmpty() ? Widget.FunctionName.ToString() : Widget.Label);
+				Instruction.Function = Program->TargetClass->FindFunctionByName(Widget.FunctionName);
+				if (!Instruction.Function || Instruction.Function->NumParms > 0)
+				{
+					AddError(*Program, Asset, WidgetIndex,
+							 FString::Printf(TEXT("%s has no function %s without parameters."), *Program->TargetClass->GetName(),
+											 *Widget.FunctionName.ToString()));
+					continue;
+				}
+				break;
+			case ESrgImGuiPanelWidgetType::BeginHeader:
+			case ESrgImGuiPanelWidgetType::BeginTreeNode:
+				Instruction.Label = FSrgImGuiLabel(Widget.Label);
+				OpenBegins.Add(Program->Instructions.Num());
+				break;
+			case ESrgImGuiPanelWidgetType::End:
+				if (OpenBegins.IsEmpty())
+				{
+					AddError(*Program, Asset, WidgetIndex, TEXT("End without a matching BeginHeader or BeginTreeNode."));
+					continue;
+				}
+				Instruction.MatchingIndex = OpenBegins.Pop();
+				Program->Instructions[Instruction.MatchingIndex].MatchingIndex = Program->Instructions.Num();
+				break;
+			default:
+				break;
+			}
+
+			Program->Instructions.Add(MoveTemp(Instruction));
+		}
+
+		// Begins that are never closed end with the panel.
+		while (!OpenBegins.IsEmpty())
+		{
+			FSrgImGuiPanelProgram::FInstruction& End = Program->Instructions.AddDefaulted_GetRef();
+			End.Type								 = ESrgImGuiPanelWidgetType::End;
+			End.MatchingIndex						 = OpenBegins.Pop();
+			Program->Instructions[End.MatchingIndex].MatchingIndex = Program->Instructions.Num() - 1;
+		}
+		return Program;
+	}
+
+	bool EvaluateCondition(const FSrgImGuiPanelPath& Condition, UObject* Target)
+	{
+		const void* Container = Condition.ResolveContainer(Target);
+		if (!Container)
+		{
+			return false;
+		}
+
+		const void* Value = Condition.Leaf->ContainerPtrToValuePtr<void>(Container);
+		if (Condition.Bool)
+		{
+			return Condition.Bool->GetPropertyValue(Value);
+		}
+		if (Condition.Numeric)
+		{
+			return Condition.Numeric->IsFloatingPoint() ? Condition.Numeric->GetFloatingPointPropertyValue(Value) != 0.0
+														: Condition.Numeric->GetUnsignedIntPropertyValue(Value) != 0;
+		}
+		return Condition.ObjectProperty->GetObjectPropertyValue(Value) != nullptr;
+	}
+
+	double GetNumericValue(const FNumericProperty& Numeric, const void* Value)
+	{
+		return Numeric.IsFloatingPoint() ? Numeric.GetFloatingPointPropertyValue(Value)
+										 : static_cast<double>(Numeric.GetSignedIntPropertyValue(Value));
+	}
+
+	// Writes the value as text to Buffer. Only values that are not bool or numeric need a string conversion.
+	void FormatValue(const FSrgImGuiPanelPath& Path, const void* Container, int32 Precision,
+					 ANSICHAR (&Buffer)[VALUE_BUFFER_SIZE])
+	{
+		const void* Value = Path.Leaf->ContainerPtrToValuePtr<void>(Container);
+		if (Path.Bool)
+		{
+			FCStringAnsi::Strncpy(Buffer, Path.Bool->GetPropertyValue(Value) ? "true" : "false", VALUE_BUFFER_SIZE);
+		}
+		else if (Path.Numeric && !CastField<FEnumProperty>(Path.Leaf) && !Path.Numeric->IsEnum())
+		{
+			if (Path.Numeric->IsFloatingPoint())
+			{
+				FCStringAnsi::Snprintf(Buffer, VALUE_BUFFER_SIZE, "%.*f", Precision,
+									   Path.Numeric->GetFloatingPointPropertyValue(Value));
+			}
+			else
+			{
+				FCStringAnsi::Snprintf(Buffer, VALUE_BUFFER_SIZE, "%lld", Path.Numeric->GetSignedIntPropertyValue(Value));
+			}
+		}
+		else
+		{
+			FString Text;
+			Path.Leaf->ExportTextItem_Direct(Text, Value, nullptr, nullptr, PPF_None);
+			SrgImGuiStats::CountStringConversion();
+			const auto Utf8		 = StringCast<UTF8CHAR>(*Text, Text.Len());
+			const UTF8CHAR* Data = Utf8.Get();
+
+			// Long values are cut before the code point that does not fit, not in the middle of it.
+			int32 Length = FMath::Min(Utf8.Length(), VALUE_BUFFER_SIZE - 1);
+			while (Length > 0 && Length < Utf8.Length() && (Data[Length] & 0xC0) == 0x80)
+			{
+				--Length;
+			}
+			FMemory::Memcpy(Buffer, Data, Length);
+			Buffer[Length] = '\0';
+		}
+	}
+
+	// Draws one widget that is not a Begin or End. Returns true if a property was modified.
+	bool DrawWidget(const FSrgImGuiPanelProgram::FInstruction& Instruction, UObject* Target)
+	{
+		void* Container = Instruction.Value.IsSet() ? Instruction.Value.ResolveContainer(Target) : nullptr;
+		if (Instruction.Value.IsSet() && !Container)
+		{
+			if (Instruction.Type == ESrgImGuiPanelWidgetType::Text)
+			{
+				ImGui::TextDisabled("%sNone%s", Instruction.Prefix.GetUtf8(), Instruction.Suffix.GetUtf8());
+			}
+			else
+			{
+				ImGui::TextDisabled("%s None", Instruction.Label.GetUtf8());
+			}
+			return false;
+		}
+
+		ANSICHAR ValueText[VALUE_BUFFER_SIZE];
+		switch (Instruction.Type)
+		{
+		case ESrgImGuiPanelWidgetType::Text:
+			if (!Container)
+			{
+				ImGui::TextUnformatted(Instruction.HasOverlay ? Instruction.Prefix.GetUtf8() : Instruction.Label.GetUtf8());
+				return false;
+			}
+			FormatValue(Instruction.Value, Container, Instruction.Precision, ValueText);
+			ImGui::Text("%s%s%s", Instruction.Prefix.GetUtf8(), ValueText, Instruction.Suffix.GetUtf8());
+			return false;
+		case ESrgImGuiPanelWidgetType::Property:
+			ImGui::TextUnformatted(Instruction.Label.GetUtf8());
+			ImGui::SameLine();
+			return SrgImGuiTypeDrawer::DrawPropertyValue(Container, Instruction.Value.Leaf, Instruction.Mutable, false, 0);
+		case ESrgImGuiPanelWidgetType::ProgressBar:
+		{
+			const void* Value	 = Instruction.Value.Leaf->ContainerPtrToValuePtr<void>(Container);
+			const double Range	 = Instruction.Max - Instruction.Min;
+			const double Current = GetNumericValue(*Instruction.Value.Numeric, Value);
+			const float Fraction =
+				Range != 0.0 ? static_cast<float>(FMath::Clamp((Current - Instruction.Min) / Range, 0.0, 1.0)) : 0.0f;
+			if (!Instruction.Label.GetText().IsEmpty())
+			{
+				ImGui::TextUnformatted(Instruction.Label.GetUtf8());
+				ImGui::SameLine();
+			}
+			if (!Instruction.HasOverlay)
+			{
+				ImGui::ProgressBar(Fraction);
+				return false;
+			}
+			ANSICHAR Overlay[OVERLAY_BUFFER_SIZE];
+			FormatValue(Instruction.Value, Container, Instruction.Precision, ValueText);
+			FCStringAnsi::Snprintf(Overlay, OVERLAY_BUFFER_SIZE, "%s%s%s", Instruction.Prefix.GetUtf8(), ValueText,
+								   Instruction.Suffix.GetUtf8());
+			ImGui::ProgressBar(Fraction, ImVec2(-FLT_MIN, 0.0f), Overlay);
+			return false;
+		}
+		case ESrgImGuiPanelWidgetType::Button:
+			if (ImGui::Button(Instruction.Label.GetUtf8()))
+			{
+				Target->ProcessEvent(Instruction.Function, nullptr);
+			}
+			return false;
+		case ESrgImGuiPanelWidgetType::Separator:
+			ImGui::Separator();
+			return false;
+		case ESrgImGuiPanelWidgetType::SameLine:
+			ImGui::SameLine();
+			return false;
+		default:
+			return false;
+		}
+	}
+}	 // namespace SrgImGuiPanelAsset_Private
+
+void USrgImGuiPanelAsset::PostLoad()
+{
+	Super::PostLoad();
+	Invalidate();
+}
+
+#if WITH_EDITOR
+void USrgImGuiPanelAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	Invalidate();
+}
+#endif
+
+void USrgImGuiPanelAsset::Invalidate()
+{
+	Program.Reset();
+}
+
+const FSrgImGuiPanelProgram& USrgImGuiPanelAsset::GetProgram()
+{
+	if (!Program || Program->TargetClass != TargetClass.Get() || !Program->IsUpToDate())
+	{
+		Program = SrgImGuiPanelAsset_Private::Compile(*this);
+	}
+	return *Program;
+}
+
+const ANSICHAR* USrgImGuiPanelAsset::GetTitle()
+{
+	return GetProgram().Title.GetUtf8();
+}
+
+bool USrgImGuiPanelAsset::Draw(UObject* Target)
+{
+	using namespace SrgImGuiPanelAsset_Private;
+
+	const FSrgImGuiPanelProgram& CurrentProgram = GetProgram();
+	for (const FSrgImGuiLabel& Error : CurrentProgram.Errors)
+	{
+		ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "%s", Error.GetUtf8());
+	}
+	if (!Target)
+	{
+		ImGui::TextDisabled("No target.");
+		return false;
+	}
+	if (!CurrentProgram.TargetClass || !Target->IsA(CurrentProgram.TargetClass))
+	{
+		ImGui::TextDisabled("%s is not a %s.", TO_IMGUI(*Target->GetName()),
+							TO_IMGUI(*GetNameSafe(CurrentProgram.TargetClass)));
+		return false;
+	}
+
+	const TArray<FSrgImGuiPanelProgram::FInstruction>& Instructions = CurrentProgram.Instructions;
+	bool WasModified												= false;
+	int32 Index														= 0;
+	while (Index < Instructions.Num())
+	{
+		const FSrgImGuiPanelProgram::FInstruction& Instruction = Instructions[Index];
+		const bool IsBegin = Instruction.Type == ESrgImGuiPanelWidgetType::BeginHeader ||
+							 Instruction.Type == ESrgImGuiPanelWidgetType::BeginTreeNode;
+
+		if (Instruction.Condition.IsSet() && EvaluateCondition(Instruction.Condition, Target) == Instruction.InvertCondition)
+		{
+			Index = IsBegin ? Instruction.MatchingIndex + 1 : Index + 1;
+			continue;
+		}
+
+		if (Instruction.HasColor())
+		{
+			ImGui::PushStyleColor(ImGuiCol_Text, Instruction.Color);
+		}
+
+		bool IsOpen = true;
+		switch (Instruction.Type)
+		{
+		case ESrgImGuiPanelWidgetType::BeginHeader:
+			ImGui::PushID(Index);
+			IsOpen = ImGui::CollapsingHeader(Instruction.Label.GetUtf8());
+			ImGui::PopID();
+			break;
+		case ESrgImGuiPanelWidgetType::BeginTreeNode:
+			// Tree nodes push their own ID until their End, so the index is used as their ID instead of being pushed.
+			IsOpen = ImGui::TreeNodeEx(reinterpret_cast<void*>(static_cast<intptr_t>(Index)), ImGuiTreeNodeFlags_None, "%s",
+									   Instruction.Label.GetUtf8());
+			break;
+		case ESrgImGuiPanelWidgetType::End:
+			if (Instructions[Instruction.MatchingIndex].Type == ESrgImGuiPanelWidgetType::BeginTreeNode)
+			{
+				ImGui::TreePop();
+			}
+			break;
+		default:
+			ImGui::PushID(Index);
+			WasModified |= DrawWidget(Instruction, Target);
+			ImGui::PopID();
+			break;
+		}
+
+		if (Instruction.HasColor())
+		{
+			ImGui::PopStyleColor();
+		}
+
+		// The End of a closed Begin is skipped as well, as there is nothing to close.
+		Index = IsOpen ? Index + 1 : Instruction.MatchingIndex + 1;
+	}
+	return WasModified;
+}
+
+USrgImGuiPanelAssetNode* USrgImGuiPanelAssetNode::CreatePanelAssetNode(USrgImGuiPanelAsset* Panel, UObject* Target)
+{
+	USrgImGuiPanelAssetNode* Node = NewObject<USrgImGuiPanelAssetNode>(Target ? Target : GetTransientPackage());
+	Node->Panel					  = Panel;
+	Node->Target				  = Target;
+	return Node;
+}
+
+ESrgImGuiDrawTreeNodeBehavior USrgImGuiPanelAssetNode::ImGui_DrawTreeNode_Start_Implementation(const FGameplayTag& NodeTag)
+{
+	if (!Panel)
+	{
+		return ESrgImGuiDrawTreeNodeBehavior::SkipChildren;
+	}
+
+	// Several nodes can show the same panel for different targets.
+	ImGui::PushID(this);
+	const bool IsOpen = ImGui::CollapsingHeader(Panel->GetTitle());
+	if (IsOpen)
+	{
+		Panel->Draw(Target.Get());
+	}
+	ImGui::PopID();
+
+	return IsOpen ? ESrgImGuiDrawTreeNodeBehavior::Continue : ESrgImGuiDrawTreeNodeBehavior::SkipChildren;
+}
+
+void USrgImGuiPanelAssetNode::ImGui_DrawTreeNode_End_Implementation(const FGameplayTag& NodeTag)
+{
+}
@@ -0,0 +1,285 @@
+// © Surgent Studios
+
+#include "Panels/SrgImGuiProfilerPanel.h"
+
+#include <imgui.h>
+
+#include "SrgImGuiStringConversion.h"
+#include "Telemetry/SrgImGuiProfiler.h"
+
+UE_DEFINE_GAMEPLAY_TAG(TAG_SrgImGui_DrawTree_Profiler, "SrgImGui.DrawTree.Profiler");
+
+namespace SrgImGuiProfilerPanel_Private
+{
+	static constexpr float FLAME_ROW_HEIGHT		= 18.0f;
+	static constexpr float FLAME_MIN_TEXT_WIDTH = 24.0f;
+
+	// Scopes with the same name and the same path from the root are merged into a single node.
+	struct FCallTreeNode
+	{
+		uint32 NameIndex	   = 0;
+		uint64 InclusiveCycles = 0;
+		uint64 ChildrenCycles  = 0;
+		int32 NumCalls		   = 0;
+		TArray<int32> Children;
+	};
+
+	double CyclesToMs(uint64 Cycles)
+	{
+		return Cycles * FPlatformTime::GetSecondsPerCycle64() * 1000.0;
+	}
+
+	TArray<FCallTreeNode> BuildCallTree(const SrgImGuiProfiler::FThreadCapture& Thread)
+	{
+		// Sorting by start time (parents first on ties) visits the scopes in depth first order.
+		TArray<SrgImGuiProfiler::FScopeRecord> Scopes = Thread.Scopes;
+		Scopes.Sort(
+			[](const SrgImGuiProfiler::FScopeRecord& A, const SrgImGuiProfiler::FScopeRecord& B)
+			{ return A.StartCycles != B.StartCycles ? A.StartCycles < B.StartCycles : A.Depth < B.Depth; });
+
+		TArray<FCallTreeNode> Nodes;
+		Nodes.AddDefaulted();
+		TArray<int32, TInlineAllocator<64>> NodeStack = {0};
+
+		for (const SrgImGuiProfiler::FScopeRecord& Scope : Scopes)
+		{
+			// The parent of a scope may have ended in another frame, in which case the scope hangs from the deepest known node.
+			NodeStack.SetNum(FMath::Min(Scope.Depth + 1, NodeStack.Num()), EAllowShrinking::No);
+			const int32 ParentIndex = NodeStack.Last();
+
+			int32 NodeIndex = INDEX_NONE;
+			for (const int32 ChildIndex : Nodes[ParentIndex].Children)
+			{
+				if (Nodes[ChildIndex].NameIndex == Scope.NameIndex)
+				{
+					NodeIndex = ChildIndex;
+					break;
+				}
+			}
+			if (NodeIndex == INDEX_NONE)
+			{
+				NodeIndex				   = Nodes.AddDefaulted();
+				Nodes[NodeIndex].NameIndex = Scope.NameIndex;
+				Nodes[ParentIndex].Children.Add(NodeIndex);
+			}
+
+			const uint64 Cycles = Scope.EndCycles - Scope.StartCycles;
+			Nodes[NodeIndex].InclusiveCycles += Cycles;
+			Nodes[NodeIndex].NumCalls++;
+			Nodes[ParentIndex].ChildrenCycles += Cycles;
+			NodeStack.Add(NodeIndex);
+		}
+
+		for (FCallTreeNode& Node : Nodes)
+		{
+			Node.Children.Sort([&Nodes](const int32 A, const int32 B)
+							   { return Nodes[A].InclusiveCycles > Nodes[B].InclusiveCycles; });
+		}
+		return Nodes;
+	}
+
+	void DrawCallTreeNode(const TArray<FCallTreeNode>& Nodes, int32 NodeIndex)
+	{
+		const FCallTreeNode& Node = Nodes[NodeIndex];
+		const uint64 SelfCycles	  = Node.InclusiveCycles - FMath::Min(Node.ChildrenCycles, Node.InclusiveCycles);
+
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGuiTreeNodeFlags Flags = ImGuiTreeNodeFlags_SpanFullWidth | ImGuiTreeNodeFlags_DefaultOpen;
+		if (Node.Children.IsEmpty())
+		{
+			Flags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+		}
+		const bool IsOpen = ImGui::TreeNodeEx(reinterpret_cast<void*>(static_cast<intptr_t>(NodeIndex)), Flags, "%s",
+											  TO_IMGUI(SrgImGuiProfiler::GetScopeName(Node.NameIndex)));
+		ImGui::TableNextColumn();
+		ImGui::Text("%.3f", CyclesToMs(Node.InclusiveCycles));
+		ImGui::TableNextColumn();
+		ImGui::Text("%.3f", CyclesToMs(SelfCycles));
+		ImGui::TableNextColumn();
+		ImGui::Text("%d", Node.NumCalls);
+
+		if (IsOpen && !Node.Children.IsEmpty())
+		{
+			for (const int32 ChildIndex : Node.Children)
+			{
+				DrawCallTreeNode(Nodes, ChildIndex);
+			}
+			ImGui::TreePop();
+		}
+	}
+
+	ImU32 GetScopeColor(uint32 NameIndex)
+	{
+		const float Hue = FMath::Frac(NameIndex * 0.618034f);
+		return ImColor::HSV(Hue, 0.45f, 0.75f);
+	}
+}	 // namespace SrgImGuiProfilerPanel_Private
+
+ESrgImGuiDrawTreeNodeBehavior USrgImGuiProfilerPanel::ImGui_DrawTreeNode_Start_Implementation(const FGameplayTag& NodeTag)
+{
+	if (!ImGui::CollapsingHeader("Profiler"))
+	{
+		return ESrgImGuiDrawTreeNodeBehavior::SkipChildren;
+	}
+
+	DrawControls();
+
+	const SrgImGuiProfiler::FFrameCapture* Frame = GetSelectedFrame();
+	if (!Frame)
+	{
+		ImGui::TextDisabled(SrgImGuiProfiler::IsEnabled() ? "No SRG_IMGUI_SCOPE recorded yet." : "The profiler is disabled.");
+		return ESrgImGuiDrawTreeNodeBehavior::Continue;
+	}
+
+	ImGui::Text("Frame %llu: %.3f ms", static_cast<unsigned long long>(Frame->FrameNumber), Frame->GetDurationMs());
+
+	for (const SrgImGuiProfiler::FThreadCapture& Thread : Frame->Threads)
+	{
+		ImGui::PushID(static_cast<int32>(Thread.ThreadId));
+		if (ImGui::TreeNodeEx("Thread", ImGuiTreeNodeFlags_DefaultOpen, "%s (%d scopes)", TO_IMGUI(*Thread.ThreadName),
+							  Thread.Scopes.Num()))
+		{
+			if (Thread.NumDroppedScopes > 0)
+			{
+				ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.0f, 1.0f), "%d scopes were dropped in this frame.",
+								   Thread.NumDroppedScopes);
+			}
+
+			if (ImGui::BeginTabBar("Views"))
+			{
+				if (ImGui::BeginTabItem("Call Tree"))
+				{
+					DrawCallTree(Thread);
+					ImGui::EndTabItem();
+				}
+				if (ImGui::BeginTabItem("Flame Graph"))
+				{
+					DrawFlameGraph(*Frame, Thread);
+					ImGui::EndTabItem();
+				}
+				ImGui::EndTabBar();
+			}
+			ImGui::TreePop();
+		}
+		ImGui::PopID();
+	}
+
+	return ESrgImGuiDrawTreeNodeBehavior::Continue;
+}
+
+void USrgImGuiProfilerPanel::ImGui_DrawTreeNode_End_Implementation(const FGameplayTag& NodeTag)
+{
+}
+
+void USrgImGuiProfilerPanel::DrawControls()
+{
+	bool Enabled = SrgImGuiProfiler::IsEnabled();
+	if (ImGui::Checkbox("Enabled", &Enabled))
+	{
+		SrgImGuiProfiler::SetEnabled(Enabled);
+	}
+
+	ImGui::SameLine();
+	bool Frozen = SrgImGuiProfiler::IsFrozen();
+	if (ImGui::Checkbox("Freeze", &Frozen))
+	{
+		SrgImGuiProfiler::SetFrozen(Frozen);
+	}
+
+	ImGui::SameLine();
+	ImGui::Checkbox("Worst Frame", &ShowWorstFrame);
+	ImGui::SameLine();
+	if (ImGui::Button("Reset Worst Frame"))
+	{
+		SrgImGuiProfiler::ResetWorstFrame();
+	}
+
+	const int32 NumFrames = SrgImGuiProfiler::GetNumFrames();
+	if (!ShowWorstFrame && NumFrames > 1)
+	{
+		SelectedFrameAge = FMath::Clamp(SelectedFrameAge, 0, NumFrames - 1);
+		ImGui::SliderInt("Frames Ago", &SelectedFrameAge, 0, NumFrames - 1);
+	}
+}
+
+const SrgImGuiProfiler::FFrameCapture* USrgImGuiProfilerPanel::GetSelectedFrame() const
+{
+	if (ShowWorstFrame)
+	{
+		return SrgImGuiProfiler::GetWorstFrame();
+	}
+
+	const int32 NumFrames = SrgImGuiProfiler::GetNumFrames();
+	return NumFrames > 0 ? &SrgImGuiProfiler::GetFrame(FMath::Clamp(SelectedFrameAge, 0, NumFrames - 1)) : nullptr;
+}
+
+void USrgImGuiProfilerPanel::DrawCallTree(const SrgImGuiProfiler::FThreadCapture& Thread) const
+{
+	using namespace SrgImGuiProfilerPanel_Private;
+
+	const TArray<FCallTreeNode> Nodes = BuildCallTree(Thread);
+
+	constexpr ImGuiTableFlags TableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_Resizable;
+	if (ImGui::BeginTable("CallTree", 4, TableFlags))
+	{
+		ImGui::TableSetupColumn("Scope", ImGuiTableColumnFlags_WidthStretch);
+		ImGui::TableSetupColumn("Total (ms)", ImGuiTableColumnFlags_WidthFixed);
+		ImGui::TableSetupColumn("Self (ms)", ImGuiTableColumnFlags_WidthFixed);
+		ImGui::TableSetupColumn("Calls", ImGuiTableColumnFlags_WidthFixed);
+		ImGui::TableHeadersRow();
+
+		for (const int32 RootChildIndex : Nodes[0].Children)
+		{
+			DrawCallTreeNode(Nodes, RootChildIndex);
+		}
+		ImGui::EndTable();
+	}
+}
+
+void USrgImGuiProfilerPanel::DrawFlameGraph(const SrgImGuiProfiler::FFrameCapture& Frame,
+											const SrgImGuiProfiler::FThreadCapture& Thread) const
+{
+	using namespace SrgImGuiProfilerPanel_Private;
+
+	int32 MaxDepth = 0;
+	for (const SrgImGuiProfiler::FScopeRecord& Scope : Thread.Scopes)
+	{
+		MaxDepth = FMath::Max(MaxDepth, Scope.Depth);
+	}
+
+	const float Width = FMath::Max(ImGui::GetContentRegionAvail().x, 1.0f);
+	ImGui::InvisibleButton("FlameGraph", ImVec2(Width, (MaxDepth + 1) * FLAME_ROW_HEIGHT));
+	const bool IsHovered	 = ImGui::IsItemHovered();
+	const ImVec2 Origin		 = ImGui::GetItemRectMin();
+	const ImVec2 MousePos	 = ImGui::GetIO().MousePos;
+	ImDrawList* DrawList	 = ImGui::GetWindowDrawList();
+	const double FrameCycles = static_cast<double>(FMath::Max<uint64>(Frame.EndCycles - Frame.StartCycles, 1));
+
+	auto CyclesToX = [&](uint64 Cycles)
+	{
+		const double Ratio = (static_cast<double>(Cycles) - static_cast<double>(Frame.StartCycles)) / FrameCycles;
+		return Origin.x + static_cast<float>(FMath::Clamp(Ratio, 0.0, 1.0)) * Width;
+	};
+
+	for (const SrgImGuiProfiler::FScopeRecord& Scope : Thread.Scopes)
+	{
+		const ImVec2 Min(CyclesToX(Scope.StartCycles), Origin.y + Scope.Depth * FLAME_ROW_HEIGHT);
+		const ImVec2 Max(FMath::Max(CyclesToX(Scope.EndCycles), Min.x + 1.0f), Min.y + FLAME_ROW_HEIGHT - 1.0f);
+		DrawList->AddRectFilled(Min, Max, GetScopeColor(Scope.NameIndex));
+
+		const auto NameString = StringCast<UTF8CHAR>(SrgImGuiProfiler::GetScopeName(Scope.NameIndex));
+		const char* Name	  = reinterpret_cast<const char*>(NameString.Get());
+		if (Max.x - Min.x >= FLAME_MIN_TEXT_WIDTH)
+		{
+			DrawList->PushClipRect(Min, Max, true);
+			DrawList->AddText(ImVec2(Min.x + 2.0f, Min.y + 1.0f), IM_COL32_WHITE, Name);
+			DrawList->PopClipRect();
+		}
+
+		if (IsHovered && MousePos.x >= Min.x && MousePos.x < Max.x && MousePos.y >= Min.y && MousePos.y < Max.y)
+		{
+			ImGui::SetTooltip("%s: %.3f ms", Name, CyclesToMs(Scope.EndCycles - Scope.StartCycles));
+		}
+	}
+}
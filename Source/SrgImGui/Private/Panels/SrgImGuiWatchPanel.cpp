@@ -0,0 +1,199 @@
+// © Surgent Studios
+
+#include "Panels/SrgImGuiWatchPanel.h"
+
+#include <imgui.h>
+
+#include "SrgImGuiMemory.h"
+#include "SrgImGuiStringConversion.h"
+#include "Library/SrgImGuiPropertyPath.h"
+#include "TypeDrawer/SrgImGuiTypeDrawer.h"
+
+UE_DEFINE_GAMEPLAY_TAG(TAG_SrgImGui_DrawTree_Watches, "SrgImGui.DrawTree.Watches");
+
+namespace SrgImGuiWatches_Private
+{
+	struct FWatch
+	{
+		TWeakObjectPtr<UObject> Object;
+		FSrgImGuiPropertyPath Path;
+		bool Mutable = false;
+	};
+
+	static TArray<FWatch> Watches;
+	// Set when a row was taller than a line (e.g. an opened struct or container), which the clipper cannot skip over.
+	static bool AnyRowExpanded = false;
+
+	static SrgImGuiMemory::FAutoRegisterGatherer WatchesGatherer(
+		[](SrgImGuiMemory::FReport& Report)
+		{
+			SIZE_T Size = Watches.GetAllocatedSize();
+			for (const FWatch& Watch : Watches)
+			{
+				Size += Watch.Path.GetAllocatedSize();
+			}
+			Report.Add(SrgImGuiMemory::Category::ItemCaches, Size, Watches.Num());
+		});
+
+	int32 FindWatch(const UObject* Object, const FString& Path)
+	{
+		return Watches.IndexOfByPredicate([Object, &Path](const FWatch& Watch)
+										  { return Watch.Object.Get() == Object && Watch.Path.GetPath() == Path; });
+	}
+}	 // namespace SrgImGuiWatches_Private
+
+void SrgImGuiWatches::Pin(UObject* Object, const FString& Path, bool Mutable)
+{
+	using namespace SrgImGuiWatches_Private;
+	check(IsInGameThread());
+
+	if (!Object)
+	{
+		return;
+	}
+
+	const int32 Index = FindWatch(Object, Path);
+	if (Index != INDEX_NONE)
+	{
+		Watches[Index].Mutable = Mutable;
+		return;
+	}
+
+	SRG_IMGUI_LLM_SCOPE();
+	Watches.Add({Object, FSrgImGuiPropertyPath(Path), Mutable});
+}
+
+void SrgImGuiWatches::Unpin(const UObject* Object, const FString& Path)
+{
+	using namespace SrgImGuiWatches_Private;
+	check(IsInGameThread());
+
+	const int32 Index = FindWatch(Object, Path);
+	if (Index != INDEX_NONE)
+	{
+		Watches.RemoveAt(Index);
+	}
+}
+
+void SrgImGuiWatches::UnpinAll()
+{
+	check(IsInGameThread());
+	SrgImGuiWatches_Private::Watches.Empty();
+}
+
+int32 SrgImGuiWatches::GetNumPinned()
+{
+	return SrgImGuiWatches_Private::Watches.Num();
+}
+
+ESrgImGuiDrawTreeNodeBehavior USrgImGuiWatchPanel::ImGui_DrawTreeNode_Start_Implementation(const FGameplayTag& NodeTag)
+{
+	using namespace SrgImGuiWatches_Private;
+
+	if (!ImGui::CollapsingHeader("Watches"))
+	{
+		return ESrgImGuiDrawTreeNodeBehavior::SkipChildren;
+	}
+
+	// The values of destroyed objects can no longer be drawn.
+	Watches.RemoveAll([](const FWatch& Watch) { return !Watch.Object.IsValid(); });
+
+	ImGui::Text("%d values", Watches.Num());
+	ImGui::SameLine();
+	if (ImGui::Button("Unpin All"))
+	{
+		Watches.Empty();
+	}
+	if (Watches.IsEmpty())
+	{
+		ImGui::TextDisabled("Pin values with SrgImGuiWatches::Pin or the Pin Watch Blueprint function.");
+		return ESrgImGuiDrawTreeNodeBehavior::Continue;
+	}
+
+	constexpr ImGuiTableFlags TableFlags =
+		ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY;
+	if (!ImGui::BeginTable("##Watches", 4, TableFlags, ImVec2(0.0f, ImGui::GetFontSize() * 24.0f)))
+	{
+		return ESrgImGuiDrawTreeNodeBehavior::Continue;
+	}
+
+	ImGui::TableSetupScrollFreeze(0, 1);
+	ImGui::TableSetupColumn("Object");
+	ImGui::TableSetupColumn("Path");
+	ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_WidthStretch);
+	ImGui::TableSetupColumn("##Unpin", ImGuiTableColumnFlags_WidthFixed);
+	ImGui::TableHeadersRow();
+
+	// Unpinning is deferred so that the rows are not shifted while they are drawn.
+	int32 UnpinIndex = INDEX_NONE;
+	auto DrawRow	 = [&UnpinIndex](int32 Index)
+	{
+		const FWatch& Watch = Watches[Index];
+		UObject* Object		= Watch.Object.Get();
+		// The ID follows the watch rather than its row, so that the opened headers stay with their value when a watch above
+		// is unpinned.
+		ImGui::PushID(static_cast<int32>(HashCombineFast(GetTypeHash(Object), GetTypeHash(Watch.Path.GetPath()))));
+
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGui::TextUnformatted(TO_IMGUI(*Object->GetName()));
+		ImGui::TableNextColumn();
+		ImGui::TextUnformatted(TO_IMGUI(*Watch.Path.GetPath()));
+
+		ImGui::TableNextColumn();
+		const float ValueStartY			   = ImGui::GetCursorPosY();
+		const FSrgImGuiPropertyValue Value = Watch.Path.Resolve(Object);
+		if (Value.IsValid())
+		{
+			ImGui::SetNextItemWidth(-FLT_MIN);
+			SrgImGuiTypeDrawer::DrawPropertyValue(Value.ContainerPtr, Value.Property, Watch.Mutable, true, Value.ArrayIndex);
+		}
+		else
+		{
+			ImGui::TextColored(ImVec4(1.f, 0.f, 0.f, 1.f), "%s", TO_IMGUI(*Watch.Path.GetError()));
+		}
+		AnyRowExpanded |= ImGui::GetCursorPosY() - ValueStartY > ImGui::GetFrameHeightWithSpacing();
+
+		ImGui::TableNextColumn();
+		if (ImGui::SmallButton("Unpin"))
+		{
+			UnpinIndex = Index;
+		}
+
+		ImGui::PopID();
+	};
+
+	// Headers are only opened on rows that are drawn, so the rows are clipped again once none of them is expanded.
+	const bool ClipRows = !AnyRowExpanded;
+	AnyRowExpanded		= false;
+	if (ClipRows)
+	{
+		ImGuiListClipper Clipper;
+		Clipper.Begin(Watches.Num());
+		while (Clipper.Step())
+		{
+			for (int32 Index = Clipper.DisplayStart; Index < Clipper.DisplayEnd; ++Index)
+			{
+				DrawRow(Index);
+			}
+		}
+	}
+	else
+	{
+		for (int32 Index = 0; Index < Watches.Num(); ++Index)
+		{
+			DrawRow(Index);
+		}
+	}
+	ImGui::EndTable();
+
+	if (UnpinIndex != INDEX_NONE)
+	{
+		Watches.RemoveAt(UnpinIndex);
+	}
+	return ESrgImGuiDrawTreeNodeBehavior::Continue;
+}
+
+void USrgImGuiWatchPanel::ImGui_DrawTreeNode_End_Implementation(const FGameplayTag& NodeTag)
+{
+}
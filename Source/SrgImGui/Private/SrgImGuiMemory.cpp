@@ -0,0 +1,67 @@
+// © Surgent Studios
+
+#include "SrgImGuiMemory.h"
+
+#include "HAL/IConsoleManager.h"
+
+LLM_DEFINE_TAG(SrgImGui);
+
+void SrgImGuiMemory::FReport::Add(const TCHAR* CategoryName, SIZE_T AllocatedBytes, int32 NumEntries /* = 0*/)
+{
+	FCategoryUsage& Usage = Categories.FindOrAdd(CategoryName);
+	Usage.AllocatedBytes += AllocatedBytes;
+	Usage.NumEntries += NumEntries;
+}
+
+SIZE_T SrgImGuiMemory::FReport::GetTotalAllocatedBytes() const
+{
+	SIZE_T Total = 0;
+	for (const TPair<FString, FCategoryUsage>& Pair : Categories)
+	{
+		Total += Pair.Value.AllocatedBytes;
+	}
+	return Total;
+}
+
+void SrgImGuiMemory::FReport::Log(FOutputDevice& Ar) const
+{
+	TArray<FString> SortedNames;
+	Categories.GetKeys(SortedNames);
+	SortedNames.Sort();
+
+	Ar.Logf(TEXT("SrgImGui memory report:"));
+	for (const FString& Name : SortedNames)
+	{
+		const FCategoryUsage& Usage = Categories[Name];
+		Ar.Logf(TEXT("  %-24s %10.2f KB (%d entries)"), *Name, Usage.AllocatedBytes / 1024.0, Usage.NumEntries);
+	}
+	Ar.Logf(TEXT("  %-24s %10.2f KB"), TEXT("Total"), GetTotalAllocatedBytes() / 1024.0);
+	Ar.Logf(TEXT("Allocations made while drawing (including ImGui's) are tracked under the \"SrgImGui\" LLM tag."));
+}
+
+SrgImGuiMemory::FOnGatherReport& SrgImGuiMemory::OnGatherReport()
+{
+	static FOnGatherReport Delegate;
+	return Delegate;
+}
+
+SrgImGuiMemory::FReport SrgImGuiMemory::GatherReport()
+{
+	FReport Report;
+	OnGatherReport().Broadcast(Report);
+	return Report;
+}
+
+SrgImGuiMemory::FAutoRegisterGatherer::FAutoRegisterGatherer(TFunction<void(FReport&)> Gatherer)
+{
+	Handle = OnGatherReport().AddLambda(MoveTemp(Gatherer));
+}
+
+SrgImGuiMemory::FAutoRegisterGatherer::~FAutoRegisterGatherer()
+{
+	OnGatherReport().Remove(Handle);
+}
+
+static FAutoConsoleCommandWithOutputDevice SrgImGuiMemReportCommand(
+	TEXT("SrgImGui.MemReport"), TEXT("Logs the memory used by SRG ImGui, grouped by category."),
+	FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar) { SrgImGuiMemory::GatherReport().Log(Ar); }));
@@ -2,4 +2,16 @@
 
 #include "SrgImGuiModule.h"
 
-IMPLEMENT_MODULE(FSrgImGuiModule, SrgImGui)
\ No newline at end of file
+#include "Panels/SrgImGuiWatchPanel.h"
+#include "Telemetry/SrgImGuiLogCapture.h"
+
+IMPLEMENT_MODULE(FSrgImGuiModule, SrgImGui)
+
+void FSrgImGuiModule::ShutdownModule()
+{
+	// GLog outlives the module and must not keep the capture device.
+	SrgImGuiLogCapture::Stop();
+	// The watches are static and would otherwise be destroyed after the UObject system, which their paths and weak
+	// pointers still read from.
+	SrgImGuiWatches::UnpinAll();
+}
\ No newline at end of file
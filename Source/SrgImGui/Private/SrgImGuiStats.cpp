@@ -0,0 +1,36 @@
+// © Surgent Studios
+
+#include "SrgImGuiStats.h"
+
+DEFINE_STAT(STAT_SrgImGui_DrawTree);
+DEFINE_STAT(STAT_SrgImGui_DrawType);
+DEFINE_STAT(STAT_SrgImGui_InputProcessing);
+
+DEFINE_STAT(STAT_SrgImGui_NodesDrawn);
+DEFINE_STAT(STAT_SrgImGui_PropertiesDrawn);
+DEFINE_STAT(STAT_SrgImGui_ContainerElementsDrawn);
+DEFINE_STAT(STAT_SrgImGui_StringConversions);
+
+CSV_DEFINE_CATEGORY_MODULE(SRGIMGUI_API, SrgImGui, true);
+
+#if SRG_IMGUI_STATS
+SrgImGuiStats::FFrameCounters SrgImGuiStats::GFrameCounters;
+#endif
+
+void SrgImGuiStats::FlushFrameCounters()
+{
+#if SRG_IMGUI_STATS
+	INC_DWORD_STAT_BY(STAT_SrgImGui_NodesDrawn, GFrameCounters.NodesDrawn);
+	INC_DWORD_STAT_BY(STAT_SrgImGui_PropertiesDrawn, GFrameCounters.PropertiesDrawn);
+	INC_DWORD_STAT_BY(STAT_SrgImGui_ContainerElementsDrawn, GFrameCounters.ContainerElementsDrawn);
+	INC_DWORD_STAT_BY(STAT_SrgImGui_StringConversions, GFrameCounters.StringConversions);
+
+	CSV_CUSTOM_STAT(SrgImGui, NodesDrawn, int32(GFrameCounters.NodesDrawn), ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(SrgImGui, PropertiesDrawn, int32(GFrameCounters.PropertiesDrawn), ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(SrgImGui, ContainerElementsDrawn, int32(GFrameCounters.ContainerElementsDrawn),
+					ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(SrgImGui, StringConversions, int32(GFrameCounters.StringConversions), ECsvCustomStatOp::Accumulate);
+
+	GFrameCounters = FFrameCounters();
+#endif
+}
@@ -9,11 +9,24 @@
 #include "Framework/Application/IInputProcessor.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Slate/SceneViewport.h"
+#include "UObject/UObjectIterator.h"
 
+#include "SrgImGuiMemory.h"
 #include "SrgImGuiSettings.h"
+#include "SrgImGuiStats.h"
 #include "SrgImGuiStringConversion.h"
+#include "SrgImGuiTrace.h"
 #include "Interfaces/SrgImGuiDrawTreeNode.h"
 #include "Library/SrgImGuiTypeLibrary.h"
+#include "Panels/SrgImGuiLogPanel.h"
+#include "Panels/SrgImGuiMetricsPanel.h"
+#include "Panels/SrgImGuiObjectTablePanel.h"
+#include "Panels/SrgImGuiProfilerPanel.h"
+#include "Panels/SrgImGuiWatchPanel.h"
+#include "Telemetry/SrgImGuiLogCapture.h"
+#include "Telemetry/SrgImGuiMetrics.h"
+#include "Telemetry/SrgImGuiProfiler.h"
+#include "Telemetry/SrgImGuiSubmissionQueue.h"
 
 DEFINE_LOG_CATEGORY(LogSrgImGui);
 
@@ -86,6 +99,9 @@ public:
 
 	bool HandleKeyDownEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent) override
 	{
+		SCOPE_CYCLE_COUNTER(STAT_SrgImGui_InputProcessing);
+		CSV_SCOPED_TIMING_STAT(SrgImGui, InputProcessing);
+
 		if (!IsRelevantKeyDownEvent(SlateApp, InKeyEvent))
 		{
 			return false;
@@ -114,6 +130,9 @@ public:
 
 	bool HandleKeyUpEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent) override
 	{
+		SCOPE_CYCLE_COUNTER(STAT_SrgImGui_InputProcessing);
+		CSV_SCOPED_TIMING_STAT(SrgImGui, InputProcessing);
+
 		for (int32 Index = 0; Index < NUM_CHORD_KEYS; ++Index)
 		{
 			int32& Progress			  = ChordKeys_Progress[Index];
@@ -177,6 +196,8 @@ void USrgImGuiSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	}
 #endif
 
+	SRG_IMGUI_LLM_SCOPE();
+
 	if (FSlateApplication::IsInitialized())
 	{
 		InputProcessor = MakeShared<FSrgImGuiInputProcessor>(this);
@@ -189,6 +210,10 @@ void USrgImGuiSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 	SubsystemsWithVisibleWindow.Remove(this);
 	UpdateFocusBasedOnGlobalVisibility(*this);
+
+	RegisterBuiltInPanels();
+
+	MemoryReportHandle = SrgImGuiMemory::OnGatherReport().AddUObject(this, &USrgImGuiSubsystem::GatherMemoryReport);
 }
 
 void USrgImGuiSubsystem::Deinitialize()
@@ -206,6 +231,14 @@ void USrgImGuiSubsystem::Deinitialize()
 		FSlateApplication::Get().UnregisterInputPreProcessor(InputProcessor);
 	}
 	InputProcessor.Reset();
+	BuiltInPanels.Reset();
+	// The submissions outlive the world, so the ones made to its nodes are dropped with it.
+	for (const TPair<FGameplayTag, TWeakObjectPtr<UObject>>& Pair : DrawTree_TagsToObjects)
+	{
+		ClearNodeSubmissions(Pair.Key);
+	}
+	SrgImGuiMemory::OnGatherReport().Remove(MemoryReportHandle);
+	MemoryReportHandle.Reset();
 	SubsystemsWithVisibleWindow.Remove(this);
 	UpdateFocusBasedOnGlobalVisibility(*this);
 
@@ -222,6 +255,7 @@ void USrgImGuiSubsystem::ToggleVisibility()
 	}
 	else
 	{
+		SRG_IMGUI_LLM_SCOPE();
 		ImGuiHandle = FImGuiDelegates::OnWorldDebug(GetWorld()).AddUObject(this, &USrgImGuiSubsystem::Draw);
 		SubsystemsWithVisibleWindow.Add(this);
 	}
@@ -254,7 +288,16 @@ void USrgImGuiSubsystem::UpdateFocusBasedOnGlobalVisibility(USrgImGuiSubsystem&
 
 void USrgImGuiSubsystem::Draw()
 {
+	SCOPE_CYCLE_COUNTER(STAT_SrgImGui_DrawTree);
+	CSV_SCOPED_TIMING_STAT(SrgImGui, DrawTree);
+	SRG_IMGUI_LLM_SCOPE();
+
+	SrgImGuiSubmission::DrainQueue();
+	SrgImGuiMetrics::Aggregate();
+	SrgImGuiProfiler::CollectFrame();
 	DrawNodeTag(TAG_SrgImGui_DrawTree);
+
+	SrgImGuiStats::FlushFrameCounters();
 }
 
 void USrgImGuiSubsystem::DrawNodeTag(const FGameplayTag& NodeTag)
@@ -271,11 +314,16 @@ void USrgImGuiSubsystem::DrawNodeTag(const FGameplayTag& NodeTag)
 		return;
 	}
 
+	SrgImGuiStats::CountNodeDrawn();
+	SrgImGuiTrace::FScope TraceScope(NodeTag);
+
 	ImGui::PushID(TO_IMGUI(*NodeTag.ToString()));
 	const ESrgImGuiDrawTreeNodeBehavior Behavior =
 		ISrgImGuiDrawTreeNode::Execute_ImGui_DrawTreeNode_Start(CurrentObject.Get(), NodeTag);
 	if (Behavior != ESrgImGuiDrawTreeNodeBehavior::Stop)
 	{
+		SrgImGuiSubmission::DrawNodeSubmissions(NodeTag);
+
 		if (Behavior != ESrgImGuiDrawTreeNodeBehavior::SkipChildren)
 		{
 			for (const FGameplayTag& Child : GetChildrenByPriority(NodeTag))
@@ -329,6 +377,8 @@ bool USrgImGuiSubsystem::RegisterToDrawTree(
 	ESrgImGuiAddToDrawTreeConflictSolver TagsConflictSolver /* = ESrgImGuiAddToDrawTreeConflictSolver::IgnoreWithWarning*/,
 	ESrgImGuiAddToDrawTreeConflictSolver NodeConflictSolver /* = ESrgImGuiAddToDrawTreeConflictSolver::IgnoreWithWarning*/)
 {
+	SRG_IMGUI_LLM_SCOPE();
+
 	UObject* NodeObject = Node.GetObject();
 	if (!NodeObject || !NodeObject->GetClass()->ImplementsInterface(USrgImGuiDrawTreeNode::StaticClass()))
 	{
@@ -433,6 +483,7 @@ bool USrgImGuiSubsystem::UnregisterFromDrawTree(TScriptInterface<ISrgImGuiDrawTr
 	{
 		check(DrawTree_TagsToObjects[Tag] == NodeObject);
 		DrawTree_TagsToObjects.Remove(Tag);
+		ClearNodeSubmissions(Tag);
 	}
 	DrawTree_ObjectToTags.Remove(NodeObject);
 	return true;
@@ -466,3 +517,74 @@ void USrgImGuiSubsystem::DrawDebugDrawTree_Internal(const FGameplayTag& NodeTag)
 	}
 	ImGui::Unindent();
 }
+
+void USrgImGuiSubsystem::RegisterBuiltInPanels()
+{
+	const USrgImGuiSettings* Settings = GetDefault<USrgImGuiSettings>();
+
+	if (Settings->MetricsPanel)
+	{
+		USrgImGuiMetricsPanel* MetricsPanel = NewObject<USrgImGuiMetricsPanel>(this);
+		BuiltInPanels.Add(MetricsPanel);
+		RegisterToDrawTree({TAG_SrgImGui_DrawTree_Metrics}, MetricsPanel);
+	}
+
+	if (Settings->ProfilerPanel)
+	{
+		USrgImGuiProfilerPanel* ProfilerPanel = NewObject<USrgImGuiProfilerPanel>(this);
+		BuiltInPanels.Add(ProfilerPanel);
+		RegisterToDrawTree({TAG_SrgImGui_DrawTree_Profiler}, ProfilerPanel);
+	}
+
+	if (Settings->LogPanel)
+	{
+		// The capture is shared by every subsystem and runs until the module shuts down.
+		SrgImGuiLogCapture::Start(static_cast<SIZE_T>(Settings->LogPanelHistorySizeMB) * 1024 * 1024);
+		USrgImGuiLogPanel* LogPanel = NewObject<USrgImGuiLogPanel>(this);
+		BuiltInPanels.Add(LogPanel);
+		RegisterToDrawTree({TAG_SrgImGui_DrawTree_Log}, LogPanel);
+	}
+
+	if (Settings->ObjectTablePanel)
+	{
+		USrgImGuiObjectTablePanel* ObjectTablePanel = NewObject<USrgImGuiObjectTablePanel>(this);
+		BuiltInPanels.Add(ObjectTablePanel);
+		RegisterToDrawTree({TAG_SrgImGui_DrawTree_ObjectTable}, ObjectTablePanel);
+	}
+
+	if (Settings->WatchPanel)
+	{
+		USrgImGuiWatchPanel* WatchPanel = NewObject<USrgImGuiWatchPanel>(this);
+		BuiltInPanels.Add(WatchPanel);
+		RegisterToDrawTree({TAG_SrgImGui_DrawTree_Watches}, WatchPanel);
+	}
+}
+
+void USrgImGuiSubsystem::ClearNodeSubmissions(const FGameplayTag& NodeTag) const
+{
+	// The submissions are keyed by node tag and shared by every world.
+	for (TObjectIterator<USrgImGuiSubsystem> It; It; ++It)
+	{
+		if (*It != this && It->DrawTree_TagsToObjects.Contains(NodeTag))
+		{
+			return;
+		}
+	}
+	SrgImGuiSubmission::ClearNodeSubmissions(NodeTag);
+}
+
+void USrgImGuiSubsystem::GatherMemoryReport(SrgImGuiMemory::FReport& Report) const
+{
+	SIZE_T DrawTreeBytes = DrawTree_TagsToObjects.GetAllocatedSize() + DrawTree_ObjectToTags.GetAllocatedSize();
+	for (const TPair<TWeakObjectPtr<UObject>, TSet<FGameplayTag>>& Pair : DrawTree_ObjectToTags)
+	{
+		DrawTreeBytes += Pair.Value.GetAllocatedSize();
+	}
+	Report.Add(SrgImGuiMemory::Category::DrawTreeMaps, DrawTreeBytes, DrawTree_TagsToObjects.Num());
+
+	const SIZE_T StringCacheBytes = CachedToggleVisibilityChordKeys_Keyboard_AsString.GetAllocatedSize() +
+									CachedToggleVisibilityChordKeys_Gamepad_AsString.GetAllocatedSize() +
+									CachedToggleFocusChordKeys_Keyboard_AsString.GetAllocatedSize() +
+									CachedToggleFocusChordKeys_Gamepad_AsString.GetAllocatedSize();
+	Report.Add(SrgImGuiMemory::Category::StringCaches, StringCacheBytes, AreChordKeysAsStringCached ? 4 : 0);
+}
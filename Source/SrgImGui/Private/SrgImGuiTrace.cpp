@@ -0,0 +1,53 @@
+// © Surgent Studios
+
+#include "SrgImGuiTrace.h"
+
+#include "GameplayTagContainer.h"
+
+#if SRG_IMGUI_TRACE_ENABLED
+UE_TRACE_CHANNEL_DEFINE(SrgImGuiChannel);
+
+// Structured metadata for each inspected type so that analyzers do not need to parse the scope names.
+UE_TRACE_EVENT_BEGIN(SrgImGui, TypeDrawn)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, PropertyCount)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, TypeName)
+UE_TRACE_EVENT_END()
+#endif
+
+void SrgImGuiTrace::FScope::BeginNode(const FGameplayTag& NodeTag)
+{
+#if SRG_IMGUI_TRACE_ENABLED
+	const FString ScopeName = FString::Printf(TEXT("SrgImGui Node: %s"), *NodeTag.ToString());
+	FCpuProfilerTrace::OutputBeginDynamicEvent(*ScopeName);
+	IsActive = true;
+#endif
+}
+
+void SrgImGuiTrace::FScope::BeginType(const UStruct& Type)
+{
+#if SRG_IMGUI_TRACE_ENABLED
+	uint32 PropertyCount = 0;
+	for (TFieldIterator<FProperty> PropIt(&Type); PropIt; ++PropIt)
+	{
+		++PropertyCount;
+	}
+
+	const FString TypeName	= Type.GetName();
+	const FString ScopeName = FString::Printf(TEXT("SrgImGui Type: %s (%u properties)"), *TypeName, PropertyCount);
+	FCpuProfilerTrace::OutputBeginDynamicEvent(*ScopeName);
+	IsActive = true;
+
+	UE_TRACE_LOG(SrgImGui, TypeDrawn, SrgImGuiChannel)
+		<< TypeDrawn.Cycle(FPlatformTime::Cycles64()) << TypeDrawn.PropertyCount(PropertyCount)
+		<< TypeDrawn.TypeName(*TypeName, TypeName.Len());
+#endif
+}
+
+void SrgImGuiTrace::FScope::End()
+{
+#if SRG_IMGUI_TRACE_ENABLED
+	FCpuProfilerTrace::OutputEndEvent();
+	IsActive = false;
+#endif
+}
@@ -0,0 +1,217 @@
+// © Surgent Studios
+
+#include "Telemetry/SrgImGuiLatencyHistogram.h"
+
+#include <imgui.h>
+
+#include "SrgImGuiStringConversion.h"
+
+namespace SrgImGuiLatencyHistogram_Private
+{
+	// One bar per power of two.
+	static constexpr int32 NUM_DISTRIBUTION_BARS = FSrgImGuiLatencyHistogram::MAX_VALUE_BITS;
+
+	int32 GetDistributionBarIndex(int32 BucketIndex)
+	{
+		const uint64 HighestValue = FSrgImGuiLatencyHistogram::GetBucketHighestValue(BucketIndex);
+		return HighestValue > 0 ? FMath::FloorLog2_64(HighestValue) : 0;
+	}
+
+	void UpdateMin(std::atomic<uint64>& Min, uint64 Value)
+	{
+		uint64 Current = Min.load(std::memory_order_relaxed);
+		while (Value < Current && !Min.compare_exchange_weak(Current, Value, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	void UpdateMax(std::atomic<uint64>& Max, uint64 Value)
+	{
+		uint64 Current = Max.load(std::memory_order_relaxed);
+		while (Value > Current && !Max.compare_exchange_weak(Current, Value, std::memory_order_relaxed))
+		{
+		}
+	}
+}	 // namespace SrgImGuiLatencyHistogram_Private
+
+FSrgImGuiLatencyHistogram::FSrgImGuiLatencyHistogram()
+{
+	for (std::atomic<uint64>& Count : Counts)
+	{
+		Count.store(0, std::memory_order_relaxed);
+	}
+}
+
+int32 FSrgImGuiLatencyHistogram::GetBucketIndex(uint64 Value)
+{
+	Value = FMath::Min(Value, MAX_VALUE);
+	if (Value < 2 * SUB_BUCKET_COUNT)
+	{
+		return static_cast<int32>(Value);
+	}
+
+	// The top SUB_BUCKET_BITS + 1 bits of the value select the bucket inside its power of two.
+	const int32 Magnitude = static_cast<int32>(FMath::FloorLog2_64(Value)) - SUB_BUCKET_BITS;
+	return Magnitude * SUB_BUCKET_COUNT + static_cast<int32>(Value >> Magnitude);
+}
+
+uint64 FSrgImGuiLatencyHistogram::GetBucketHighestValue(int32 BucketIndex)
+{
+	if (BucketIndex < 2 * SUB_BUCKET_COUNT)
+	{
+		return BucketIndex;
+	}
+
+	const int32 Magnitude = BucketIndex / SUB_BUCKET_COUNT - 1;
+	const uint64 Mantissa = BucketIndex % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+	return ((Mantissa + 1) << Magnitude) - 1;
+}
+
+void FSrgImGuiLatencyHistogram::RecordValue(uint64 Value)
+{
+	using namespace SrgImGuiLatencyHistogram_Private;
+	Value = FMath::Min(Value, MAX_VALUE);
+
+	Counts[GetBucketIndex(Value)].fetch_add(1, std::memory_order_relaxed);
+	TotalCount.fetch_add(1, std::memory_order_relaxed);
+	TotalSum.fetch_add(Value, std::memory_order_relaxed);
+	UpdateMin(MinValue, Value);
+	UpdateMax(MaxValue, Value);
+}
+
+void FSrgImGuiLatencyHistogram::Merge(const FSrgImGuiLatencyHistogram& Other)
+{
+	using namespace SrgImGuiLatencyHistogram_Private;
+	check(&Other != this);
+
+	for (int32 BucketIndex = 0; BucketIndex < NUM_BUCKETS; ++BucketIndex)
+	{
+		const uint64 OtherCount = Other.Counts[BucketIndex].load(std::memory_order_relaxed);
+		if (OtherCount > 0)
+		{
+			Counts[BucketIndex].fetch_add(OtherCount, std::memory_order_relaxed);
+		}
+	}
+	TotalCount.fetch_add(Other.TotalCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	TotalSum.fetch_add(Other.TotalSum.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	UpdateMin(MinValue, Other.MinValue.load(std::memory_order_relaxed));
+	UpdateMax(MaxValue, Other.MaxValue.load(std::memory_order_relaxed));
+}
+
+void FSrgImGuiLatencyHistogram::Reset()
+{
+	for (std::atomic<uint64>& Count : Counts)
+	{
+		Count.store(0, std::memory_order_relaxed);
+	}
+	TotalCount.store(0, std::memory_order_relaxed);
+	TotalSum.store(0, std::memory_order_relaxed);
+	MinValue.store(MAX_uint64, std::memory_order_relaxed);
+	MaxValue.store(0, std::memory_order_relaxed);
+}
+
+uint64 FSrgImGuiLatencyHistogram::GetMinValue() const
+{
+	const uint64 Min = MinValue.load(std::memory_order_relaxed);
+	return Min == MAX_uint64 ? 0 : Min;
+}
+
+double FSrgImGuiLatencyHistogram::GetMean() const
+{
+	const uint64 Count = GetTotalCount();
+	return Count > 0 ? static_cast<double>(TotalSum.load(std::memory_order_relaxed)) / Count : 0.0;
+}
+
+uint64 FSrgImGuiLatencyHistogram::GetValueAtPercentile(double Percentile) const
+{
+	uint64 Value = 0;
+	GetValuesAtPercentiles(MakeArrayView(&Percentile, 1), MakeArrayView(&Value, 1));
+	return Value;
+}
+
+void FSrgImGuiLatencyHistogram::GetValuesAtPercentiles(TConstArrayView<double> Percentiles, TArrayView<uint64> OutValues) const
+{
+	check(Percentiles.Num() == OutValues.Num());
+
+	// Other threads may be recording, so the total is taken from the buckets themselves rather than from TotalCount.
+	uint64 Total = 0;
+	for (const std::atomic<uint64>& Count : Counts)
+	{
+		Total += Count.load(std::memory_order_relaxed);
+	}
+
+	int32 PercentileIndex = 0;
+	if (Total > 0)
+	{
+		uint64 CumulativeCount = 0;
+		for (int32 BucketIndex = 0; BucketIndex < NUM_BUCKETS && PercentileIndex < Percentiles.Num(); ++BucketIndex)
+		{
+			CumulativeCount += Counts[BucketIndex].load(std::memory_order_relaxed);
+			while (PercentileIndex < Percentiles.Num())
+			{
+				const double Ratio		 = FMath::Clamp(Percentiles[PercentileIndex], 0.0, 100.0) / 100.0;
+				const uint64 TargetCount = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(Ratio * Total)));
+				if (CumulativeCount < TargetCount)
+				{
+					break;
+				}
+				OutValues[PercentileIndex++] = FMath::Min(GetBucketHighestValue(BucketIndex), GetMaxValue());
+			}
+		}
+	}
+
+	for (; PercentileIndex < Percentiles.Num(); ++PercentileIndex)
+	{
+		OutValues[PercentileIndex] = Total > 0 ? GetMaxValue() : 0;
+	}
+}
+
+void FSrgImGuiLatencyHistogram::DrawDistribution(const TCHAR* Label, const TCHAR* Unit /*= TEXT("")*/,
+												 FVector2D Size /*= FVector2D::ZeroVector*/) const
+{
+	using namespace SrgImGuiLatencyHistogram_Private;
+
+	float Bars[NUM_DISTRIBUTION_BARS] = {};
+	int32 FirstBar					  = NUM_DISTRIBUTION_BARS;
+	int32 LastBar					  = -1;
+	for (int32 BucketIndex = 0; BucketIndex < NUM_BUCKETS; ++BucketIndex)
+	{
+		const uint64 Count = Counts[BucketIndex].load(std::memory_order_relaxed);
+		if (Count > 0)
+		{
+			const int32 BarIndex = GetDistributionBarIndex(BucketIndex);
+			Bars[BarIndex] += static_cast<float>(Count);
+			FirstBar = FMath::Min(FirstBar, BarIndex);
+			LastBar	 = FMath::Max(LastBar, BarIndex);
+		}
+	}
+
+	const auto UnitString	 = StringCast<UTF8CHAR>(Unit);
+	const ANSICHAR* UnitText = reinterpret_cast<const ANSICHAR*>(UnitString.Get());
+
+	ImGui::PushID(TO_IMGUI(Label));
+	if (LastBar < 0)
+	{
+		ImGui::PlotHistogram(TO_IMGUI(Label), Bars, 0, 0, "No samples", 0.0f, 1.0f, ImVec2(Size.X, Size.Y));
+	}
+	else
+	{
+		const uint64 RangeMin = FirstBar > 0 ? uint64(1) << FirstBar : 0;
+		const uint64 RangeMax = (uint64(2) << LastBar) - 1;
+		char OverlayText[64];
+		FCStringAnsi::Snprintf(OverlayText, sizeof(OverlayText), "%llu - %llu %s",
+							   static_cast<unsigned long long>(RangeMin), static_cast<unsigned long long>(RangeMax), UnitText);
+		ImGui::PlotHistogram(TO_IMGUI(Label), Bars + FirstBar, LastBar - FirstBar + 1, 0, OverlayText, 0.0f, FLT_MAX,
+							 ImVec2(Size.X, Size.Y));
+	}
+
+	static constexpr double READOUT_PERCENTILES[] = {50.0, 90.0, 99.0};
+	uint64 PercentileValues[UE_ARRAY_COUNT(READOUT_PERCENTILES)];
+	GetValuesAtPercentiles(READOUT_PERCENTILES, PercentileValues);
+
+	ImGui::Text("n %llu  mean %.1f  p50 %llu  p90 %llu  p99 %llu  max %llu %s",
+				static_cast<unsigned long long>(GetTotalCount()), GetMean(), static_cast<unsigned long long>(PercentileValues[0]),
+				static_cast<unsigned long long>(PercentileValues[1]), static_cast<unsigned long long>(PercentileValues[2]),
+				static_cast<unsigned long long>(GetMaxValue()), UnitText);
+	ImGui::PopID();
+}
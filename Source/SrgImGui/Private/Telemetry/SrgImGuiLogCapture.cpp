@@ -0,0 +1,423 @@
+// © Surgent Studios
+
+#include "Telemetry/SrgImGuiLogCapture.h"
+
+#include "Algo/BinarySearch.h"
+#include "Containers/Ticker.h"
+#include "Misc/OutputDeviceRedirector.h"
+
+#include "SrgImGuiMemory.h"
+
+#include <atomic>
+
+namespace SrgImGuiLogCapture_Private
+{
+	// Must be a power of two.
+	static constexpr uint64 RING_BUFFER_SIZE = 1024 * 1024;
+	static constexpr uint64 RING_BUFFER_MASK = RING_BUFFER_SIZE - 1;
+	static constexpr uint64 RECORD_ALIGNMENT = 8;
+	// Longer messages are truncated so that a single message cannot fill the ring buffer.
+	static constexpr int32 MAX_MESSAGE_CHARACTERS = 4096;
+	static constexpr int32 HISTORY_CHUNK_SIZE	  = 64 * 1024;
+	// Set in the size of the records that only skip the end of the ring buffer.
+	static constexpr uint32 PADDING_FLAG = 1u << 31;
+
+	// Starts every record of the ring buffer, followed by the UTF-8 text of the message.
+	struct FRecordHeader
+	{
+		// The tag of the position of the record in the upper 32 bits and the size of the record in the lower 32 bits.
+		// Written last, so the record is complete once the tag matches its position.
+		int64 TagAndSize;
+		double Time;
+		FName Category;
+		int32 TextLength;
+		uint8 Verbosity;
+	};
+
+	// Tells a record from what the previous laps of the ring buffer left at the same place. Never 0 on the first lap, as the
+	// ring buffer starts zeroed.
+	uint32 GetPositionTag(uint64 Position)
+	{
+		return static_cast<uint32>(Position / RECORD_ALIGNMENT) + 1;
+	}
+
+	/**
+	 * Output device writing every message to a multi-producer ring buffer. Producers reserve their record with a CAS on the
+	 * write position, write it in place and publish it by writing its tag. The game thread consumes the published records in
+	 * order, up to the first record that is still being written.
+	 */
+	class FLogCaptureDevice : public FOutputDevice
+	{
+	public:
+		FLogCaptureDevice()
+			: Buffer(static_cast<uint8*>(FMemory::MallocZeroed(RING_BUFFER_SIZE, RECORD_ALIGNMENT)))
+		{
+		}
+
+		virtual ~FLogCaptureDevice() override { FMemory::Free(Buffer); }
+
+		virtual void Serialize(const TCHAR* Message, ELogVerbosity::Type Verbosity, const FName& Category) override
+		{
+			Serialize(Message, Verbosity, Category, -1.0);
+		}
+
+		virtual void Serialize(const TCHAR* Message, ELogVerbosity::Type Verbosity, const FName& Category,
+							   const double Time) override
+		{
+			const ELogVerbosity::Type Level = static_cast<ELogVerbosity::Type>(Verbosity & ELogVerbosity::VerbosityMask);
+			if (!Message || Level == ELogVerbosity::SetColor || Level == ELogVerbosity::NoLogging)
+			{
+				return;
+			}
+
+			const int32 MessageLength = FMath::Min(FCString::Strlen(Message), MAX_MESSAGE_CHARACTERS);
+			const int32 TextLength	  = FPlatformString::ConvertedLength<UTF8CHAR>(Message, MessageLength);
+			const uint64 RecordSize	  = Align(sizeof(FRecordHeader) + TextLength, RECORD_ALIGNMENT);
+
+			uint64 Position = WritePosition.load(std::memory_order_relaxed);
+			uint64 Padding	= 0;
+			do
+			{
+				// Records are contiguous, so a record that would wrap around starts at the beginning of the ring buffer.
+				const uint64 Offset = Position & RING_BUFFER_MASK;
+				Padding				= Offset + RecordSize > RING_BUFFER_SIZE ? RING_BUFFER_SIZE - Offset : 0;
+				if (Position + Padding + RecordSize - ReadPosition.load(std::memory_order_acquire) > RING_BUFFER_SIZE)
+				{
+					NumDropped.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+			} while (!WritePosition.compare_exchange_weak(Position, Position + Padding + RecordSize, std::memory_order_acq_rel,
+														  std::memory_order_relaxed));
+
+			if (Padding > 0)
+			{
+				Publish(Position, static_cast<uint32>(Padding) | PADDING_FLAG);
+				Position += Padding;
+			}
+
+			FRecordHeader* Header = GetHeader(Position);
+			Header->Time		  = Time >= 0.0 ? Time : FPlatformTime::Seconds() - GStartTime;
+			Header->Category	  = Category;
+			Header->TextLength	  = TextLength;
+			Header->Verbosity	  = static_cast<uint8>(Level);
+			FPlatformString::Convert(reinterpret_cast<UTF8CHAR*>(Header + 1), TextLength, Message, MessageLength);
+			Publish(Position, static_cast<uint32>(RecordSize));
+		}
+
+		virtual bool CanBeUsedOnAnyThread() const override { return true; }
+		virtual bool CanBeUsedOnMultipleThreads() const override { return true; }
+
+		// Calls ReadRecord(const FRecordHeader&, const ANSICHAR* Text) on every published record, oldest first, and frees them.
+		template <typename ReadFunctorType>
+		void Consume(ReadFunctorType&& ReadRecord)
+		{
+			uint64 Position			 = ReadPosition.load(std::memory_order_relaxed);
+			const uint64 EndPosition = WritePosition.load(std::memory_order_acquire);
+			while (Position < EndPosition)
+			{
+				const FRecordHeader* Header = GetHeader(Position);
+				const uint64 TagAndSize		= static_cast<uint64>(FPlatformAtomics::AtomicRead(&Header->TagAndSize));
+				if (static_cast<uint32>(TagAndSize >> 32) != GetPositionTag(Position))
+				{
+					break;
+				}
+
+				const uint32 Size = static_cast<uint32>(TagAndSize);
+				if (!(Size & PADDING_FLAG))
+				{
+					ReadRecord(*Header, reinterpret_cast<const ANSICHAR*>(Header + 1));
+				}
+				Position += Size & ~PADDING_FLAG;
+			}
+			ReadPosition.store(Position, std::memory_order_release);
+		}
+
+		uint32 GetNumDropped() const { return NumDropped.load(std::memory_order_relaxed); }
+
+	private:
+		FRecordHeader* GetHeader(uint64 Position) const
+		{
+			return reinterpret_cast<FRecordHeader*>(Buffer + (Position & RING_BUFFER_MASK));
+		}
+
+		void Publish(uint64 Position, uint32 Size) const
+		{
+			const int64 TagAndSize = static_cast<int64>((static_cast<uint64>(GetPositionTag(Position)) << 32) | Size);
+			FPlatformAtomics::AtomicStore(&GetHeader(Position)->TagAndSize, TagAndSize);
+		}
+
+		uint8* Buffer = nullptr;
+		std::atomic<uint32> NumDropped{0};
+
+		// Producers and the consumer write to these constantly, so they are kept on separate cache lines.
+		alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> WritePosition{0};
+		alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> ReadPosition{0};
+	};
+
+	struct FStoredLine
+	{
+		double Time			= 0.0;
+		int32 TextOffset	= 0;
+		int32 Length		= 0;
+		int32 CategoryIndex = 0;
+		uint8 Verbosity		= 0;
+	};
+
+	// A block of consecutive lines. The history drops whole chunks, oldest first.
+	struct FChunk
+	{
+		uint64 FirstLine = 0;
+		// Reserved up front and never grown, so that the text of the lines does not move.
+		TArray<ANSICHAR> Text;
+		TArray<FStoredLine> Lines;
+
+		SIZE_T GetAllocatedSize() const { return sizeof(FChunk) + Text.GetAllocatedSize() + Lines.GetAllocatedSize(); }
+	};
+
+	// The captured lines. Only accessed from the game thread.
+	class FHistory
+	{
+	public:
+		void AddMessage(const FRecordHeader& Header, const ANSICHAR* Text)
+		{
+			const int32 CategoryIndex = FindOrAddCategory(Header.Category);
+
+			// Every line of a message becomes a line of the history, so that every line has the same height when drawn.
+			const ANSICHAR* End = Text + Header.TextLength;
+			for (const ANSICHAR* LineStart = Text;;)
+			{
+				const ANSICHAR* LineEnd = LineStart;
+				while (LineEnd < End && *LineEnd != '\n')
+				{
+					++LineEnd;
+				}
+				const int32 Length = static_cast<int32>(LineEnd - LineStart);
+				AddLine(Header, CategoryIndex, LineStart, Length > 0 && LineStart[Length - 1] == '\r' ? Length - 1 : Length);
+
+				if (LineEnd == End)
+				{
+					break;
+				}
+				LineStart = LineEnd + 1;
+			}
+		}
+
+		SrgImGuiLogCapture::FLine GetLine(uint64 LineNumber) const
+		{
+			check(LineNumber >= FirstLine && LineNumber < EndLine);
+			const int32 ChunkIndex =
+				Algo::UpperBoundBy(Chunks, LineNumber, [](const TUniquePtr<FChunk>& Chunk) { return Chunk->FirstLine; }) - 1;
+			const FChunk& Chunk		  = *Chunks[ChunkIndex];
+			const FStoredLine& Stored = Chunk.Lines[static_cast<int32>(LineNumber - Chunk.FirstLine)];
+
+			SrgImGuiLogCapture::FLine Line;
+			Line.Text		   = Chunk.Text.GetData() + Stored.TextOffset;
+			Line.Length		   = Stored.Length;
+			Line.Time		   = Stored.Time;
+			Line.CategoryIndex = Stored.CategoryIndex;
+			Line.Verbosity	   = static_cast<ELogVerbosity::Type>(Stored.Verbosity);
+			return Line;
+		}
+
+		void Reset(SIZE_T InMaxBytes)
+		{
+			MaxBytes = InMaxBytes;
+			Chunks.Empty();
+			SealedBytes = 0;
+			FirstLine	= EndLine;
+			for (SrgImGuiLogCapture::FCategory& Category : Categories)
+			{
+				Category.NumLines = 0;
+			}
+		}
+
+		SIZE_T GetMaxBytes() const { return MaxBytes; }
+		uint64 GetFirstLine() const { return FirstLine; }
+		uint64 GetEndLine() const { return EndLine; }
+		const TArray<SrgImGuiLogCapture::FCategory>& GetCategories() const { return Categories; }
+
+		SIZE_T GetAllocatedSize() const
+		{
+			SIZE_T Size = SealedBytes + Chunks.GetAllocatedSize() + Categories.GetAllocatedSize() +
+						  CategoryIndices.GetAllocatedSize();
+			if (!Chunks.IsEmpty())
+			{
+				Size += Chunks.Last()->GetAllocatedSize();
+			}
+			for (const SrgImGuiLogCapture::FCategory& Category : Categories)
+			{
+				Size += Category.Utf8.GetAllocatedSize();
+			}
+			return Size;
+		}
+
+	private:
+		int32 FindOrAddCategory(FName Name)
+		{
+			if (const int32* Index = CategoryIndices.Find(Name))
+			{
+				return *Index;
+			}
+
+			SrgImGuiLogCapture::FCategory& Category = Categories.AddDefaulted_GetRef();
+			Category.Name							= Name;
+			const FTCHARToUTF8 Converted(*Name.ToString());
+			Category.Utf8.Append(reinterpret_cast<const ANSICHAR*>(Converted.Get()), Converted.Length());
+			Category.Utf8.Add('\0');
+			return CategoryIndices.Add(Name, Categories.Num() - 1);
+		}
+
+		void AddLine(const FRecordHeader& Header, int32 CategoryIndex, const ANSICHAR* Text, int32 Length)
+		{
+			if (Chunks.IsEmpty() || Chunks.Last()->Text.Num() + Length > Chunks.Last()->Text.Max())
+			{
+				AddChunk(Length);
+			}
+
+			FChunk& Chunk	   = *Chunks.Last();
+			FStoredLine& Line  = Chunk.Lines.AddDefaulted_GetRef();
+			Line.Time		   = Header.Time;
+			Line.TextOffset	   = Chunk.Text.Num();
+			Line.Length		   = Length;
+			Line.CategoryIndex = CategoryIndex;
+			Line.Verbosity	   = Header.Verbosity;
+			Chunk.Text.Append(Text, Length);
+
+			++Categories[CategoryIndex].NumLines;
+			++EndLine;
+		}
+
+		void AddChunk(int32 MinSize)
+		{
+			if (!Chunks.IsEmpty())
+			{
+				SealedBytes += Chunks.Last()->GetAllocatedSize();
+			}
+
+			// Drops the oldest chunks to make room for the new one.
+			while (!Chunks.IsEmpty() && SealedBytes + HISTORY_CHUNK_SIZE > MaxBytes)
+			{
+				const FChunk& Oldest = *Chunks[0];
+				for (const FStoredLine& Line : Oldest.Lines)
+				{
+					--Categories[Line.CategoryIndex].NumLines;
+				}
+				SealedBytes -= Oldest.GetAllocatedSize();
+				Chunks.RemoveAt(0);
+			}
+
+			TUniquePtr<FChunk>& Chunk = Chunks.Add_GetRef(MakeUnique<FChunk>());
+			Chunk->FirstLine		  = EndLine;
+			Chunk->Text.Reserve(FMath::Max(HISTORY_CHUNK_SIZE, MinSize));
+			FirstLine = Chunks[0]->FirstLine;
+		}
+
+		SIZE_T MaxBytes = 0;
+		TArray<TUniquePtr<FChunk>> Chunks;
+		// The size of every chunk but the last one, which is still growing.
+		SIZE_T SealedBytes = 0;
+		uint64 FirstLine   = 0;
+		uint64 EndLine	   = 0;
+
+		TArray<SrgImGuiLogCapture::FCategory> Categories;
+		TMap<FName, int32> CategoryIndices;
+	};
+
+	// Created when the capture starts and destroyed once removed from GLog when it stops.
+	static FLogCaptureDevice* Device = nullptr;
+	static FHistory History;
+	static FTSTicker::FDelegateHandle TickerHandle;
+
+	bool Tick(float DeltaTime)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+		Device->Consume([](const FRecordHeader& Header, const ANSICHAR* Text) { History.AddMessage(Header, Text); });
+		return true;
+	}
+
+	static SrgImGuiMemory::FAutoRegisterGatherer LogCaptureGatherer(
+		[](SrgImGuiMemory::FReport& Report)
+		{
+			if (Device)
+			{
+				Report.Add(SrgImGuiMemory::Category::LogCapture, RING_BUFFER_SIZE + History.GetAllocatedSize(),
+						   static_cast<int32>(History.GetEndLine() - History.GetFirstLine()));
+			}
+		});
+}	 // namespace SrgImGuiLogCapture_Private
+
+void SrgImGuiLogCapture::Start(SIZE_T MaxHistoryBytes)
+{
+	using namespace SrgImGuiLogCapture_Private;
+	check(IsInGameThread());
+
+	if (Device || !GLog)
+	{
+		return;
+	}
+
+	SRG_IMGUI_LLM_SCOPE();
+	History.Reset(MaxHistoryBytes);
+	Device		 = new FLogCaptureDevice();
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(TEXT("SrgImGuiLogCapture"), 0.0f, &Tick);
+	GLog->AddOutputDevice(Device);
+}
+
+void SrgImGuiLogCapture::Stop()
+{
+	using namespace SrgImGuiLogCapture_Private;
+	check(IsInGameThread());
+
+	if (!Device)
+	{
+		return;
+	}
+
+	// Removing the device waits for the threads that are writing to it.
+	if (GLog)
+	{
+		GLog->RemoveOutputDevice(Device);
+	}
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+	delete Device;
+	Device = nullptr;
+	History.Reset(0);
+}
+
+bool SrgImGuiLogCapture::IsCapturing()
+{
+	return SrgImGuiLogCapture_Private::Device != nullptr;
+}
+
+uint64 SrgImGuiLogCapture::GetFirstLine()
+{
+	return SrgImGuiLogCapture_Private::History.GetFirstLine();
+}
+
+uint64 SrgImGuiLogCapture::GetEndLine()
+{
+	return SrgImGuiLogCapture_Private::History.GetEndLine();
+}
+
+SrgImGuiLogCapture::FLine SrgImGuiLogCapture::GetLine(uint64 LineNumber)
+{
+	return SrgImGuiLogCapture_Private::History.GetLine(LineNumber);
+}
+
+const TArray<SrgImGuiLogCapture::FCategory>& SrgImGuiLogCapture::GetCategories()
+{
+	return SrgImGuiLogCapture_Private::History.GetCategories();
+}
+
+uint32 SrgImGuiLogCapture::GetNumDropped()
+{
+	using namespace SrgImGuiLogCapture_Private;
+	return Device ? Device->GetNumDropped() : 0;
+}
+
+void SrgImGuiLogCapture::Clear()
+{
+	using namespace SrgImGuiLogCapture_Private;
+	History.Reset(History.GetMaxBytes());
+}
@@ -0,0 +1,224 @@
+// © Surgent Studios
+
+#include "Telemetry/SrgImGuiMetrics.h"
+
+#include "SrgImGuiMemory.h"
+#include "SrgImGuiSubsystem.h"
+
+#include <atomic>
+
+namespace SrgImGuiMetrics_Private
+{
+	static constexpr int32 MAX_METRICS		   = 256;
+	static constexpr int32 MAX_SHARDS		   = 32;
+	static constexpr int32 HISTORY_NUM_SAMPLES = 120;
+
+	// Every thread adds to its own shard, so counters updated from several threads do not bounce cache lines between cores.
+	// Threads beyond MAX_SHARDS share shards, which is still correct as the adds are atomic.
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FShard
+	{
+		std::atomic<int64> Counters[MAX_METRICS];
+	};
+
+	struct FRegistry
+	{
+		FShard Shards[MAX_SHARDS];
+		std::atomic<double> Gauges[MAX_METRICS];
+
+		// Written under RegistrationLock. NumMetrics is published last, so readers never see a metric half registered.
+		FCriticalSection RegistrationLock;
+		TMap<FName, int32> IndicesByName;
+		FName Names[MAX_METRICS];
+		ESrgImGuiMetricType Types[MAX_METRICS];
+		std::atomic<int32> NumMetrics{0};
+
+		std::atomic<int32> NumThreads{0};
+
+		FRegistry()
+		{
+			for (FShard& Shard : Shards)
+			{
+				for (std::atomic<int64>& Counter : Shard.Counters)
+				{
+					Counter.store(0, std::memory_order_relaxed);
+				}
+			}
+			for (std::atomic<double>& Gauge : Gauges)
+			{
+				Gauge.store(0.0, std::memory_order_relaxed);
+			}
+		}
+
+		int32 GetNumShardsInUse() const { return FMath::Min(NumThreads.load(std::memory_order_relaxed), MAX_SHARDS); }
+	};
+
+	// Never destroyed, as other threads may still update metrics during shutdown.
+	FRegistry& GetRegistry()
+	{
+		static FRegistry& Registry = *[]()
+		{
+			SRG_IMGUI_LLM_SCOPE();
+			return new FRegistry();
+		}();
+		return Registry;
+	}
+
+	FShard& GetCurrentThreadShard()
+	{
+		static thread_local int32 ShardIndex = GetRegistry().NumThreads.fetch_add(1, std::memory_order_relaxed) % MAX_SHARDS;
+		return GetRegistry().Shards[ShardIndex];
+	}
+
+	// Aggregation state. Only accessed from the game thread.
+	static TArray<SrgImGuiMetrics::FMetricSnapshot> Snapshots;
+	static TArray<int64> PreviousTotals;
+	static double LastAggregationTime = 0.0;
+	static uint64 LastAggregationFrame = MAX_uint64;
+
+	void RecordHistory(SrgImGuiMetrics::FMetricSnapshot& Snapshot, float Sample)
+	{
+		if (Snapshot.History.Num() < HISTORY_NUM_SAMPLES)
+		{
+			Snapshot.History.Add(Sample);
+		}
+		else
+		{
+			Snapshot.History[Snapshot.HistoryOffset] = Sample;
+			Snapshot.HistoryOffset					 = (Snapshot.HistoryOffset + 1) % HISTORY_NUM_SAMPLES;
+		}
+	}
+
+	static SrgImGuiMemory::FAutoRegisterGatherer MetricsGatherer(
+		[](SrgImGuiMemory::FReport& Report)
+		{
+			FRegistry& Registry = GetRegistry();
+			SIZE_T Size			= sizeof(FRegistry) + Snapshots.GetAllocatedSize() + PreviousTotals.GetAllocatedSize();
+			{
+				FScopeLock Lock(&Registry.RegistrationLock);
+				Size += Registry.IndicesByName.GetAllocatedSize();
+			}
+			for (const SrgImGuiMetrics::FMetricSnapshot& Snapshot : Snapshots)
+			{
+				Size += Snapshot.History.GetAllocatedSize();
+			}
+			Report.Add(SrgImGuiMemory::Category::Metrics, Size, Registry.NumMetrics.load(std::memory_order_acquire));
+		});
+}	 // namespace SrgImGuiMetrics_Private
+
+FSrgImGuiMetric FSrgImGuiMetric::FindOrAddCounter(FName Name)
+{
+	return FindOrAdd(Name, ESrgImGuiMetricType::Counter);
+}
+
+FSrgImGuiMetric FSrgImGuiMetric::FindOrAddGauge(FName Name)
+{
+	return FindOrAdd(Name, ESrgImGuiMetricType::Gauge);
+}
+
+FSrgImGuiMetric FSrgImGuiMetric::FindOrAdd(FName Name, ESrgImGuiMetricType Type)
+{
+	using namespace SrgImGuiMetrics_Private;
+	FRegistry& Registry = GetRegistry();
+	FScopeLock Lock(&Registry.RegistrationLock);
+
+	if (const int32* ExistingIndex = Registry.IndicesByName.Find(Name))
+	{
+		if (Registry.Types[*ExistingIndex] != Type)
+		{
+			UE_LOG(LogSrgImGui, Warning, TEXT("ImGui metric '%s' is already registered with a different type."),
+				   *Name.ToString());
+			return FSrgImGuiMetric();
+		}
+		return FSrgImGuiMetric(*ExistingIndex);
+	}
+
+	const int32 NewIndex = Registry.NumMetrics.load(std::memory_order_relaxed);
+	if (NewIndex >= MAX_METRICS)
+	{
+		UE_LOG(LogSrgImGui, Warning, TEXT("Cannot register ImGui metric '%s'. The registry is limited to %d metrics."),
+			   *Name.ToString(), MAX_METRICS);
+		return FSrgImGuiMetric();
+	}
+
+	SRG_IMGUI_LLM_SCOPE();
+	Registry.Names[NewIndex] = Name;
+	Registry.Types[NewIndex] = Type;
+	Registry.IndicesByName.Add(Name, NewIndex);
+	Registry.NumMetrics.store(NewIndex + 1, std::memory_order_release);
+	return FSrgImGuiMetric(NewIndex);
+}
+
+void FSrgImGuiMetric::Add(int64 Delta) const
+{
+	if (Index != INDEX_NONE)
+	{
+		SrgImGuiMetrics_Private::GetCurrentThreadShard().Counters[Index].fetch_add(Delta, std::memory_order_relaxed);
+	}
+}
+
+void FSrgImGuiMetric::Set(double Value) const
+{
+	if (Index != INDEX_NONE)
+	{
+		SrgImGuiMetrics_Private::GetRegistry().Gauges[Index].store(Value, std::memory_order_relaxed);
+	}
+}
+
+void SrgImGuiMetrics::Aggregate()
+{
+	using namespace SrgImGuiMetrics_Private;
+	check(IsInGameThread());
+
+	// Several subsystems (e.g. PIE clients) draw in the same frame, but the rates only make sense once per frame.
+	if (LastAggregationFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastAggregationFrame = GFrameCounter;
+
+	SRG_IMGUI_LLM_SCOPE();
+	FRegistry& Registry		 = GetRegistry();
+	const int32 NumMetrics	 = Registry.NumMetrics.load(std::memory_order_acquire);
+	const int32 NumShards	 = Registry.GetNumShardsInUse();
+	const double CurrentTime = FPlatformTime::Seconds();
+	const double ElapsedTime = LastAggregationTime > 0.0 ? CurrentTime - LastAggregationTime : 0.0;
+	LastAggregationTime		 = CurrentTime;
+
+	const int32 NumPreviousMetrics = Snapshots.Num();
+	Snapshots.SetNum(NumMetrics);
+	PreviousTotals.SetNumZeroed(NumMetrics);
+
+	for (int32 MetricIndex = 0; MetricIndex < NumMetrics; ++MetricIndex)
+	{
+		FMetricSnapshot& Snapshot = Snapshots[MetricIndex];
+		if (MetricIndex >= NumPreviousMetrics)
+		{
+			Snapshot.Name = Registry.Names[MetricIndex];
+			Snapshot.Type = Registry.Types[MetricIndex];
+			Snapshot.History.Reserve(HISTORY_NUM_SAMPLES);
+		}
+
+		if (Snapshot.Type == ESrgImGuiMetricType::Gauge)
+		{
+			Snapshot.Value = Registry.Gauges[MetricIndex].load(std::memory_order_relaxed);
+			RecordHistory(Snapshot, static_cast<float>(Snapshot.Value));
+			continue;
+		}
+
+		int64 Total = 0;
+		for (int32 ShardIndex = 0; ShardIndex < NumShards; ++ShardIndex)
+		{
+			Total += Registry.Shards[ShardIndex].Counters[MetricIndex].load(std::memory_order_relaxed);
+		}
+
+		Snapshot.Value				= static_cast<double>(Total);
+		Snapshot.RatePerSecond		= ElapsedTime > 0.0 ? (Total - PreviousTotals[MetricIndex]) / ElapsedTime : 0.0;
+		PreviousTotals[MetricIndex] = Total;
+		RecordHistory(Snapshot, static_cast<float>(Snapshot.RatePerSecond));
+	}
+}
+
+const TArray<SrgImGuiMetrics::FMetricSnapshot>& SrgImGuiMetrics::GetSnapshots()
+{
+	return SrgImGuiMetrics_Private::Snapshots;
+}
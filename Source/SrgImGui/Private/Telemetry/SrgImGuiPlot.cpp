@@ -0,0 +1,432 @@
+// © Surgent Studios
+
+#include "Telemetry/SrgImGuiPlot.h"
+
+#include <imgui.h>
+
+#include "Math/VectorRegister.h"
+
+#include "SrgImGuiMemory.h"
+
+namespace SrgImGuiPlot_Private
+{
+	static constexpr float DEFAULT_PLOT_HEIGHT_IN_LINES = 4.0f;
+	// Factor applied to the visible range per mouse wheel step.
+	static constexpr float ZOOM_STEP = 0.8f;
+	// The view cannot be zoomed in further than this many samples.
+	static constexpr float MIN_VISIBLE_SAMPLES = 4.0f;
+	// Caches of plots that were not drawn for this many frames are freed.
+	static constexpr uint64 CACHE_LIFETIME_FRAMES = 120;
+
+	struct FSeriesCache
+	{
+		// The samples the buckets were computed from. Versions only change per series, so a different series drawn in the same
+		// slot (e.g. the plot switched to another series) can have the same version.
+		const float* FirstData	= nullptr;
+		const float* SecondData = nullptr;
+		uint64 Version			= 0;
+		int32 FirstSample		= 0;
+		int32 NumSamples		= 0;
+		int32 NumBuckets		= 0;
+		TArray<float> BucketMins;
+		TArray<float> BucketMaxs;
+		float Min = 0.0f;
+		float Max = 0.0f;
+	};
+
+	struct FPlotCache
+	{
+		uint64 LastUsedFrame = 0;
+		TArray<FSeriesCache> Series;
+	};
+
+	// What is visible of a series with the current view.
+	struct FSeriesView
+	{
+		// Position of the first sample of the series. Series are aligned on their latest sample.
+		int32 Offset	  = 0;
+		int32 FirstSample = 0;
+		int32 NumSamples  = 0;
+		// Only set if the visible samples were decimated.
+		const FSeriesCache* Decimation = nullptr;
+		float Min					   = FLT_MAX;
+		float Max					   = -FLT_MAX;
+	};
+
+	// Only accessed from the game thread.
+	static TMap<ImGuiID, FPlotCache> PlotCaches;
+	static uint64 LastEvictionFrame = 0;
+
+	void ComputeMinMaxInRange(const SrgImGuiPlot::FSamples& Samples, int32 FirstSample, int32 NumSamples, float& InOutMin,
+							  float& InOutMax)
+	{
+		const int32 NumFirst = Samples.First.Num();
+		if (FirstSample < NumFirst)
+		{
+			const int32 NumInFirst = FMath::Min(NumSamples, NumFirst - FirstSample);
+			SrgImGuiPlot::ComputeMinMax(Samples.First.Slice(FirstSample, NumInFirst), InOutMin, InOutMax);
+			FirstSample += NumInFirst;
+			NumSamples -= NumInFirst;
+		}
+		if (NumSamples > 0)
+		{
+			SrgImGuiPlot::ComputeMinMax(Samples.Second.Slice(FirstSample - NumFirst, NumSamples), InOutMin, InOutMax);
+		}
+	}
+
+	void Decimate(const SrgImGuiPlot::FSamples& Samples, int32 FirstSample, int32 NumSamples, int32 NumBuckets,
+				  FSeriesCache& OutCache)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+		OutCache.FirstSample = FirstSample;
+		OutCache.NumSamples	 = NumSamples;
+		OutCache.NumBuckets	 = NumBuckets;
+		OutCache.BucketMins.SetNumUninitialized(NumBuckets, EAllowShrinking::No);
+		OutCache.BucketMaxs.SetNumUninitialized(NumBuckets, EAllowShrinking::No);
+		OutCache.Min = FLT_MAX;
+		OutCache.Max = -FLT_MAX;
+
+		for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+		{
+			const int32 BucketStart = FirstSample + static_cast<int32>(int64(NumSamples) * Bucket / NumBuckets);
+			const int32 BucketEnd	= FirstSample + static_cast<int32>(int64(NumSamples) * (Bucket + 1) / NumBuckets);
+			float BucketMin			= FLT_MAX;
+			float BucketMax			= -FLT_MAX;
+			ComputeMinMaxInRange(Samples, BucketStart, BucketEnd - BucketStart, BucketMin, BucketMax);
+
+			OutCache.BucketMins[Bucket] = BucketMin;
+			OutCache.BucketMaxs[Bucket] = BucketMax;
+			OutCache.Min				= FMath::Min(OutCache.Min, BucketMin);
+			OutCache.Max				= FMath::Max(OutCache.Max, BucketMax);
+		}
+	}
+
+	void EvictUnusedCaches()
+	{
+		if (LastEvictionFrame == GFrameCounter)
+		{
+			return;
+		}
+		LastEvictionFrame = GFrameCounter;
+
+		for (auto It = PlotCaches.CreateIterator(); It; ++It)
+		{
+			if (It->Value.LastUsedFrame + CACHE_LIFETIME_FRAMES < GFrameCounter)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	ImU32 GetSeriesColor(const SrgImGuiPlot::FSeries& Series, int32 SeriesIndex)
+	{
+		if (Series.Color.A > 0.0f)
+		{
+			return ImGui::ColorConvertFloat4ToU32(ImVec4(Series.Color.R, Series.Color.G, Series.Color.B, Series.Color.A));
+		}
+		if (SeriesIndex == 0)
+		{
+			return ImGui::GetColorU32(ImGuiCol_PlotLines);
+		}
+		return ImColor::HSV(FMath::Frac(SeriesIndex * 0.618034f), 0.6f, 0.9f);
+	}
+
+	FString GetSeriesName(const SrgImGuiPlot::FSeries& Series, int32 SeriesIndex)
+	{
+		return Series.Name && *Series.Name ? FString(Series.Name) : FString::Printf(TEXT("Series %d"), SeriesIndex);
+	}
+
+	// Zooms with the mouse wheel around the cursor, pans by dragging and resets on double click.
+	void UpdateView(float& ViewMin, float& ViewMax, int32 MaxNumSamples, float InnerMinX, float InnerWidth)
+	{
+		const ImGuiIO& IO = ImGui::GetIO();
+		if (ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))
+		{
+			ViewMin = 0.0f;
+			ViewMax = 1.0f;
+			return;
+		}
+
+		float ViewSize = ViewMax - ViewMin;
+		if (ImGui::IsItemHovered() && IO.MouseWheel != 0.0f)
+		{
+			const float MinViewSize = FMath::Min(MIN_VISIBLE_SAMPLES / FMath::Max(MaxNumSamples - 1, 1), 1.0f);
+			const float MouseRatio	= FMath::Clamp((IO.MousePos.x - InnerMinX) / InnerWidth, 0.0f, 1.0f);
+			const float Pivot		= ViewMin + ViewSize * MouseRatio;
+			ViewSize				= FMath::Clamp(ViewSize * FMath::Pow(ZOOM_STEP, IO.MouseWheel), MinViewSize, 1.0f);
+			ViewMin					= Pivot - ViewSize * MouseRatio;
+		}
+		if (ImGui::IsItemActive() && ImGui::IsMouseDragging(ImGuiMouseButton_Left))
+		{
+			ViewMin -= IO.MouseDelta.x / InnerWidth * ViewSize;
+		}
+
+		ViewMin = FMath::Clamp(ViewMin, 0.0f, 1.0f - ViewSize);
+		ViewMax = ViewMin + ViewSize;
+	}
+
+	static SrgImGuiMemory::FAutoRegisterGatherer PlotCachesGatherer(
+		[](SrgImGuiMemory::FReport& Report)
+		{
+			SIZE_T Size = PlotCaches.GetAllocatedSize();
+			for (const TPair<ImGuiID, FPlotCache>& Pair : PlotCaches)
+			{
+				Size += Pair.Value.Series.GetAllocatedSize();
+				for (const FSeriesCache& SeriesCache : Pair.Value.Series)
+				{
+					Size += SeriesCache.BucketMins.GetAllocatedSize() + SeriesCache.BucketMaxs.GetAllocatedSize();
+				}
+			}
+			Report.Add(SrgImGuiMemory::Category::PlotCaches, Size, PlotCaches.Num());
+		});
+}	 // namespace SrgImGuiPlot_Private
+
+void SrgImGuiPlot::ComputeMinMax(TConstArrayView<float> Samples, float& InOutMin, float& InOutMax)
+{
+	const float* Data = Samples.GetData();
+	const int32 Num	  = Samples.Num();
+	int32 Index		  = 0;
+
+	if (Num >= 4)
+	{
+		VectorRegister4Float VectorMinValue = VectorLoad(Data);
+		VectorRegister4Float VectorMaxValue = VectorMinValue;
+		for (Index = 4; Index + 4 <= Num; Index += 4)
+		{
+			const VectorRegister4Float Values = VectorLoad(Data + Index);
+			VectorMinValue					  = VectorMin(VectorMinValue, Values);
+			VectorMaxValue					  = VectorMax(VectorMaxValue, Values);
+		}
+
+		alignas(16) float Mins[4];
+		alignas(16) float Maxs[4];
+		VectorStoreAligned(VectorMinValue, Mins);
+		VectorStoreAligned(VectorMaxValue, Maxs);
+		InOutMin = FMath::Min(InOutMin, FMath::Min(FMath::Min(Mins[0], Mins[1]), FMath::Min(Mins[2], Mins[3])));
+		InOutMax = FMath::Max(InOutMax, FMath::Max(FMath::Max(Maxs[0], Maxs[1]), FMath::Max(Maxs[2], Maxs[3])));
+	}
+
+	for (; Index < Num; ++Index)
+	{
+		InOutMin = FMath::Min(InOutMin, Data[Index]);
+		InOutMax = FMath::Max(InOutMax, Data[Index]);
+	}
+}
+
+void SrgImGuiPlot::Lines(const TCHAR* Label, TConstArrayView<FSeries> Series, const FOptions& Options /*= FOptions()*/)
+{
+	using namespace SrgImGuiPlot_Private;
+	SRG_IMGUI_LLM_SCOPE();
+
+	const auto LabelString	= StringCast<UTF8CHAR>(Label);
+	const char* LabelText	= reinterpret_cast<const char*>(LabelString.Get());
+	const ImGuiStyle& Style = ImGui::GetStyle();
+
+	const float DefaultHeight = ImGui::GetTextLineHeight() * DEFAULT_PLOT_HEIGHT_IN_LINES + Style.FramePadding.y * 2.0f;
+	const ImVec2 PlotSize(Options.Size.X > 0.0f ? static_cast<float>(Options.Size.X) : ImGui::CalcItemWidth(),
+						  Options.Size.Y > 0.0f ? static_cast<float>(Options.Size.Y) : DefaultHeight);
+
+	// The plot is drawn in a child window so that the mouse wheel zooms the plot instead of scrolling the window.
+	ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0.0f, 0.0f));
+	const bool IsChildVisible =
+		ImGui::BeginChild(LabelText, PlotSize, false, ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoScrollWithMouse);
+	ImGui::PopStyleVar();
+	if (!IsChildVisible)
+	{
+		ImGui::EndChild();
+		return;
+	}
+
+	const ImGuiID PlotId = ImGui::GetID("Plot");
+	ImGui::InvisibleButton("Plot", PlotSize);
+	const ImVec2 FrameMin = ImGui::GetItemRectMin();
+	const ImVec2 FrameMax = ImGui::GetItemRectMax();
+	const ImVec2 InnerMin(FrameMin.x + Style.FramePadding.x, FrameMin.y + Style.FramePadding.y);
+	const ImVec2 InnerMax(FrameMax.x - Style.FramePadding.x, FrameMax.y - Style.FramePadding.y);
+	const float InnerWidth	= FMath::Max(InnerMax.x - InnerMin.x, 1.0f);
+	const float InnerHeight = FMath::Max(InnerMax.y - InnerMin.y, 1.0f);
+	ImDrawList* DrawList	= ImGui::GetWindowDrawList();
+	DrawList->AddRectFilled(FrameMin, FrameMax, ImGui::GetColorU32(ImGuiCol_FrameBg), Style.FrameRounding);
+
+	int32 MaxNumSamples = 0;
+	for (const FSeries& OneSeries : Series)
+	{
+		MaxNumSamples = FMath::Max(MaxNumSamples, OneSeries.Samples.Num());
+	}
+
+	ImGuiStorage* Storage	= ImGui::GetStateStorage();
+	const ImGuiID ViewMinId = ImGui::GetID("ViewMin");
+	const ImGuiID ViewMaxId = ImGui::GetID("ViewMax");
+	float ViewMin			= Storage->GetFloat(ViewMinId, 0.0f);
+	float ViewMax			= Storage->GetFloat(ViewMaxId, 1.0f);
+	UpdateView(ViewMin, ViewMax, MaxNumSamples, InnerMin.x, InnerWidth);
+	Storage->SetFloat(ViewMinId, ViewMin);
+	Storage->SetFloat(ViewMaxId, ViewMax);
+
+	// Positions go from 0 (the oldest sample of the longest series) to MaxNumSamples - 1 (the latest sample of every series).
+	const float LastPosition = static_cast<float>(FMath::Max(MaxNumSamples - 1, 1));
+	const float ViewStart	 = ViewMin * LastPosition;
+	const float ViewEnd		 = ViewMax * LastPosition;
+	const int32 NumBuckets	 = FMath::Max(FMath::FloorToInt(InnerWidth), 1);
+	auto PositionToX		 = [&](float Position)
+	{ return InnerMin.x + (Position - ViewStart) / (ViewEnd - ViewStart) * InnerWidth; };
+
+	EvictUnusedCaches();
+	FPlotCache& PlotCache	= PlotCaches.FindOrAdd(PlotId);
+	PlotCache.LastUsedFrame = GFrameCounter;
+	PlotCache.Series.SetNum(Series.Num());
+
+	TArray<FSeriesView, TInlineAllocator<8>> Views;
+	Views.SetNum(Series.Num());
+	float ScaleMin = FLT_MAX;
+	float ScaleMax = -FLT_MAX;
+	for (int32 SeriesIndex = 0; SeriesIndex < Series.Num(); ++SeriesIndex)
+	{
+		const FSamples& Samples = Series[SeriesIndex].Samples;
+		FSeriesView& View		= Views[SeriesIndex];
+		View.Offset				= MaxNumSamples - Samples.Num();
+		View.FirstSample		= FMath::Max(FMath::FloorToInt(ViewStart) - View.Offset, 0);
+		const int32 LastSample	= FMath::Min(FMath::CeilToInt(ViewEnd) - View.Offset, Samples.Num() - 1);
+		View.NumSamples			= FMath::Max(LastSample - View.FirstSample + 1, 0);
+		if (View.NumSamples == 0)
+		{
+			continue;
+		}
+
+		if (View.NumSamples > NumBuckets * 2)
+		{
+			FSeriesCache& SeriesCache = PlotCache.Series[SeriesIndex];
+			const uint64 Version	  = Series[SeriesIndex].Version;
+			const bool IsCacheValid	  = Version != 0 && SeriesCache.Version == Version &&
+									  SeriesCache.FirstData == Samples.First.GetData() &&
+									  SeriesCache.SecondData == Samples.Second.GetData() &&
+									  SeriesCache.FirstSample == View.FirstSample && SeriesCache.NumSamples == View.NumSamples &&
+									  SeriesCache.NumBuckets == NumBuckets;
+			if (!IsCacheValid)
+			{
+				Decimate(Samples, View.FirstSample, View.NumSamples, NumBuckets, SeriesCache);
+				SeriesCache.FirstData  = Samples.First.GetData();
+				SeriesCache.SecondData = Samples.Second.GetData();
+				SeriesCache.Version	   = Version;
+			}
+			View.Decimation = &SeriesCache;
+			View.Min		= SeriesCache.Min;
+			View.Max		= SeriesCache.Max;
+		}
+		else
+		{
+			ComputeMinMaxInRange(Samples, View.FirstSample, View.NumSamples, View.Min, View.Max);
+		}
+		ScaleMin = FMath::Min(ScaleMin, View.Min);
+		ScaleMax = FMath::Max(ScaleMax, View.Max);
+	}
+
+	ScaleMin = Options.Min != FLT_MAX ? Options.Min : ScaleMin;
+	ScaleMax = Options.Max != FLT_MAX ? Options.Max : ScaleMax;
+	if (ScaleMin == FLT_MAX || ScaleMax == -FLT_MAX)
+	{
+		ScaleMin = 0.0f;
+		ScaleMax = 1.0f;
+	}
+	else if (ScaleMax <= ScaleMin)
+	{
+		ScaleMax = ScaleMin + 1.0f;
+	}
+	auto SampleToY = [&](float Sample)
+	{ return InnerMax.y - FMath::Clamp((Sample - ScaleMin) / (ScaleMax - ScaleMin), 0.0f, 1.0f) * InnerHeight; };
+
+	DrawList->PushClipRect(InnerMin, InnerMax, true);
+	TArray<ImVec2, TInlineAllocator<512>> Points;
+	for (int32 SeriesIndex = 0; SeriesIndex < Series.Num(); ++SeriesIndex)
+	{
+		const FSeriesView& View = Views[SeriesIndex];
+		const FSamples& Samples = Series[SeriesIndex].Samples;
+		Points.Reset();
+		if (View.Decimation)
+		{
+			// A vertical segment per pixel from the min to the max of its samples.
+			for (int32 Bucket = 0; Bucket < View.Decimation->NumBuckets; ++Bucket)
+			{
+				const int32 BucketStart = View.FirstSample + static_cast<int32>(int64(View.NumSamples) * Bucket / NumBuckets);
+				const float X			= PositionToX(static_cast<float>(View.Offset + BucketStart));
+				Points.Add(ImVec2(X, SampleToY(View.Decimation->BucketMaxs[Bucket])));
+				Points.Add(ImVec2(X, SampleToY(View.Decimation->BucketMins[Bucket])));
+			}
+		}
+		else
+		{
+			for (int32 Index = View.FirstSample; Index < View.FirstSample + View.NumSamples; ++Index)
+			{
+				Points.Add(ImVec2(PositionToX(static_cast<float>(View.Offset + Index)), SampleToY(Samples[Index])));
+			}
+		}
+
+		if (Points.Num() >= 2)
+		{
+			DrawList->AddPolyline(Points.GetData(), Points.Num(), GetSeriesColor(Series[SeriesIndex], SeriesIndex), 0, 1.0f);
+		}
+	}
+	DrawList->PopClipRect();
+
+	if (Options.OverlayText && *Options.OverlayText)
+	{
+		const auto OverlayString = StringCast<UTF8CHAR>(Options.OverlayText);
+		const char* Overlay		 = reinterpret_cast<const char*>(OverlayString.Get());
+		const float OverlayWidth = ImGui::CalcTextSize(Overlay).x;
+		DrawList->AddText(ImVec2(InnerMin.x + (InnerWidth - OverlayWidth) * 0.5f, InnerMin.y), ImGui::GetColorU32(ImGuiCol_Text),
+						  Overlay);
+	}
+
+	if (ImGui::IsItemHovered() && MaxNumSamples > 0)
+	{
+		const float MouseRatio = (ImGui::GetIO().MousePos.x - InnerMin.x) / InnerWidth;
+		const int32 Position =
+			FMath::Clamp(FMath::RoundToInt(ViewStart + MouseRatio * (ViewEnd - ViewStart)), 0, MaxNumSamples - 1);
+		const float HoveredX = PositionToX(static_cast<float>(Position));
+		DrawList->AddLine(ImVec2(HoveredX, InnerMin.y), ImVec2(HoveredX, InnerMax.y), ImGui::GetColorU32(ImGuiCol_TextDisabled));
+
+		ImGui::BeginTooltip();
+		ImGui::TextDisabled("Sample %d", Position);
+		for (int32 SeriesIndex = 0; SeriesIndex < Series.Num(); ++SeriesIndex)
+		{
+			const int32 Index = Position - Views[SeriesIndex].Offset;
+			if (Index >= 0 && Index < Series[SeriesIndex].Samples.Num())
+			{
+				const auto NameString = StringCast<UTF8CHAR>(*GetSeriesName(Series[SeriesIndex], SeriesIndex));
+				ImGui::TextColored(ImGui::ColorConvertU32ToFloat4(GetSeriesColor(Series[SeriesIndex], SeriesIndex)), "%s: %.3f",
+								   reinterpret_cast<const char*>(NameString.Get()), Series[SeriesIndex].Samples[Index]);
+			}
+		}
+		ImGui::EndTooltip();
+	}
+	ImGui::EndChild();
+
+	const char* LabelEnd = FCStringAnsi::Strstr(LabelText, "##");
+	if (LabelEnd != LabelText)
+	{
+		ImGui::SameLine(0.0f, Style.ItemInnerSpacing.x);
+		ImGui::TextUnformatted(LabelText, LabelEnd);
+	}
+
+	if (Series.Num() > 1)
+	{
+		ImGui::PushID(LabelText);
+		for (int32 SeriesIndex = 0; SeriesIndex < Series.Num(); ++SeriesIndex)
+		{
+			if (SeriesIndex > 0)
+			{
+				ImGui::SameLine();
+			}
+			ImGui::PushID(SeriesIndex);
+			const ImVec4 Color	   = ImGui::ColorConvertU32ToFloat4(GetSeriesColor(Series[SeriesIndex], SeriesIndex));
+			const float LineHeight = ImGui::GetTextLineHeight();
+			ImGui::ColorButton("##Legend", Color, ImGuiColorEditFlags_NoTooltip | ImGuiColorEditFlags_NoPicker,
+							   ImVec2(LineHeight, LineHeight));
+			ImGui::SameLine(0.0f, Style.ItemInnerSpacing.x);
+			const auto NameString = StringCast<UTF8CHAR>(*GetSeriesName(Series[SeriesIndex], SeriesIndex));
+			ImGui::TextUnformatted(reinterpret_cast<const char*>(NameString.Get()));
+			ImGui::PopID();
+		}
+		ImGui::PopID();
+	}
+}
@@ -0,0 +1,409 @@
+// © Surgent Studios
+
+#include "Telemetry/SrgImGuiProfiler.h"
+
+#include "HAL/ThreadManager.h"
+
+#include "SrgImGuiMemory.h"
+
+#include <atomic>
+
+#if SRG_IMGUI_PROFILER_ENABLED
+bool GSrgImGuiProfilerEnabled = false;
+
+static FAutoConsoleVariableRef CVarSrgImGuiProfilerEnabled(
+	TEXT("SrgImGui.Profiler.Enabled"), GSrgImGuiProfilerEnabled,
+	TEXT("If enabled, SRG_IMGUI_SCOPE scopes are recorded and shown in the SRG ImGui profiler panel."));
+#endif
+
+namespace SrgImGuiProfiler_Private
+{
+	static constexpr uint32 RING_CAPACITY			   = 16 * 1024;
+	static constexpr uint32 RING_INDEX_MASK			   = RING_CAPACITY - 1;
+	static constexpr int32 MAX_DEPTH				   = 64;
+	static constexpr int32 MAX_SCOPES_PER_THREAD_FRAME = 4096;
+	static constexpr int32 MAX_FRAMES				   = 120;
+
+	struct FEvent
+	{
+		uint64 Cycles	 = 0;
+		uint32 NameIndex = 0;
+		bool IsBegin	 = false;
+	};
+
+	struct FOpenScope
+	{
+		uint64 StartCycles = 0;
+		uint32 NameIndex   = 0;
+	};
+
+	/**
+	 * Ring of events written by a single thread and read by the game thread.
+	 * The writer publishes each event by bumping WritePosition. The reader copies the published events and then checks
+	 * WritePosition again to discard the ones that may have been overwritten while copying.
+	 */
+	struct FThreadRing
+	{
+		FEvent Events[RING_CAPACITY];
+		alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> WritePosition{0};
+
+		uint32 ThreadId = 0;
+		FString ThreadName;
+		// Set when the thread exits. Its last events are then read and the ring is recycled for a new thread.
+		std::atomic<bool> ThreadExited{false};
+
+		// Only accessed by the reader.
+		uint64 ReadPosition = 0;
+		TArray<FOpenScope> OpenScopes;
+	};
+
+	struct FProfilerState
+	{
+		// Rings are never destroyed, as their threads may still record while the profiler shuts down. The rings of exited
+		// threads are kept in FreeRings and reused, so that short-lived threads do not add a ring each.
+		FCriticalSection RingsLock;
+		TArray<FThreadRing*> Rings;
+		TArray<FThreadRing*> FreeRings;
+
+		FCriticalSection NamesLock;
+		TArray<FString> Names;
+	};
+
+	FProfilerState& GetState()
+	{
+		static FProfilerState& State = *[]()
+		{
+			SRG_IMGUI_LLM_SCOPE();
+			return new FProfilerState();
+		}();
+		return State;
+	}
+
+	FThreadRing& AcquireCurrentThreadRing()
+	{
+		SRG_IMGUI_LLM_SCOPE();
+		FProfilerState& State = GetState();
+
+		FThreadRing* Ring = nullptr;
+		{
+			FScopeLock Lock(&State.RingsLock);
+			if (!State.FreeRings.IsEmpty())
+			{
+				Ring = State.FreeRings.Pop(EAllowShrinking::No);
+			}
+		}
+		if (Ring)
+		{
+			// The reader no longer accesses a free ring, and publishes it again below under the lock.
+			Ring->WritePosition.store(0, std::memory_order_relaxed);
+			Ring->ThreadExited.store(false, std::memory_order_relaxed);
+			Ring->ReadPosition = 0;
+			Ring->OpenScopes.Reset();
+		}
+		else
+		{
+			Ring = new FThreadRing();
+		}
+
+		Ring->ThreadId	 = FPlatformTLS::GetCurrentThreadId();
+		Ring->ThreadName = IsInGameThread() ? FString(TEXT("GameThread")) : FThreadManager::GetThreadName(Ring->ThreadId);
+		if (Ring->ThreadName.IsEmpty())
+		{
+			Ring->ThreadName = FString::Printf(TEXT("Thread %u"), Ring->ThreadId);
+		}
+
+		FScopeLock Lock(&State.RingsLock);
+		State.Rings.Add(Ring);
+		return *Ring;
+	}
+
+	// Owns the ring of a thread and flags it when the thread exits.
+	struct FThreadRingOwner
+	{
+		FThreadRing& Ring;
+
+		~FThreadRingOwner() { Ring.ThreadExited.store(true, std::memory_order_release); }
+	};
+
+	FThreadRing& GetCurrentThreadRing()
+	{
+		static thread_local FThreadRingOwner Owner{AcquireCurrentThreadRing()};
+		return Owner.Ring;
+	}
+
+	// Collection state. Only accessed from the game thread.
+	static TArray<SrgImGuiProfiler::FFrameCapture> Frames;
+	static int32 NextFrameIndex = 0;
+	static TOptional<SrgImGuiProfiler::FFrameCapture> WorstFrame;
+	static bool IsCaptureFrozen		   = false;
+	static uint64 LastCollectionCycles = 0;
+	static uint64 LastCollectionFrame  = MAX_uint64;
+	static TArray<FEvent> ReadEvents;
+
+	// Copies the events published since the last read and returns how many are valid.
+	int32 ReadRing(FThreadRing& Ring)
+	{
+		const uint64 WritePosition = Ring.WritePosition.load(std::memory_order_acquire);
+		if (WritePosition - Ring.ReadPosition > RING_CAPACITY)
+		{
+			// The writer lapped the reader (e.g. while ImGui was hidden). The open scopes cannot be matched anymore.
+			Ring.ReadPosition = WritePosition - RING_CAPACITY;
+			Ring.OpenScopes.Reset();
+		}
+
+		const int32 NumEvents = static_cast<int32>(WritePosition - Ring.ReadPosition);
+		ReadEvents.SetNumUninitialized(NumEvents, EAllowShrinking::No);
+		for (int32 Index = 0; Index < NumEvents; ++Index)
+		{
+			ReadEvents[Index] = Ring.Events[(Ring.ReadPosition + Index) & RING_INDEX_MASK];
+		}
+
+		// The writer may have reused the oldest slots while they were copied.
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const uint64 OverwrittenPosition = Ring.WritePosition.load(std::memory_order_relaxed) + 1;
+		int32 FirstValidEvent			 = 0;
+		if (OverwrittenPosition > RING_CAPACITY && OverwrittenPosition - RING_CAPACITY > Ring.ReadPosition)
+		{
+			FirstValidEvent = static_cast<int32>(
+				FMath::Min<uint64>(OverwrittenPosition - RING_CAPACITY - Ring.ReadPosition, static_cast<uint64>(NumEvents)));
+			Ring.OpenScopes.Reset();
+		}
+		if (FirstValidEvent > 0)
+		{
+			ReadEvents.RemoveAt(0, FirstValidEvent, EAllowShrinking::No);
+		}
+
+		Ring.ReadPosition = WritePosition;
+		return ReadEvents.Num();
+	}
+
+	void CollectRing(FThreadRing& Ring, SrgImGuiProfiler::FThreadCapture& OutCapture)
+	{
+		ReadRing(Ring);
+
+		for (const FEvent& Event : ReadEvents)
+		{
+			if (Event.IsBegin)
+			{
+				if (Ring.OpenScopes.Num() < MAX_DEPTH)
+				{
+					Ring.OpenScopes.Add({Event.Cycles, Event.NameIndex});
+				}
+				continue;
+			}
+
+			if (Ring.OpenScopes.IsEmpty() || Ring.OpenScopes.Last().NameIndex != Event.NameIndex)
+			{
+				// Its begin event was lost or dropped for being too deep.
+				continue;
+			}
+
+			const FOpenScope OpenScope = Ring.OpenScopes.Pop(EAllowShrinking::No);
+			if (OutCapture.Scopes.Num() >= MAX_SCOPES_PER_THREAD_FRAME)
+			{
+				++OutCapture.NumDroppedScopes;
+				continue;
+			}
+			OutCapture.Scopes.Add({OpenScope.StartCycles, Event.Cycles, OpenScope.NameIndex, Ring.OpenScopes.Num()});
+		}
+	}
+
+	static SrgImGuiMemory::FAutoRegisterGatherer ProfilerGatherer(
+		[](SrgImGuiMemory::FReport& Report)
+		{
+			FProfilerState& State = GetState();
+			SIZE_T Size			  = sizeof(FProfilerState) + Frames.GetAllocatedSize() + ReadEvents.GetAllocatedSize();
+			{
+				FScopeLock Lock(&State.RingsLock);
+				Size += State.Rings.GetAllocatedSize() + State.FreeRings.GetAllocatedSize() +
+						(State.Rings.Num() + State.FreeRings.Num()) * sizeof(FThreadRing);
+			}
+			{
+				FScopeLock Lock(&State.NamesLock);
+				Size += State.Names.GetAllocatedSize();
+			}
+
+			auto AddFrameSize = [&Size](const SrgImGuiProfiler::FFrameCapture& Frame)
+			{
+				Size += Frame.Threads.GetAllocatedSize();
+				for (const SrgImGuiProfiler::FThreadCapture& Thread : Frame.Threads)
+				{
+					Size += Thread.Scopes.GetAllocatedSize() + Thread.ThreadName.GetAllocatedSize();
+				}
+			};
+			for (const SrgImGuiProfiler::FFrameCapture& Frame : Frames)
+			{
+				AddFrameSize(Frame);
+			}
+			if (WorstFrame.IsSet())
+			{
+				AddFrameSize(WorstFrame.GetValue());
+			}
+			Report.Add(SrgImGuiMemory::Category::Profiler, Size, Frames.Num());
+		});
+}	 // namespace SrgImGuiProfiler_Private
+
+SrgImGuiProfiler::FScopeName::FScopeName(const TCHAR* Name)
+{
+	using namespace SrgImGuiProfiler_Private;
+	FProfilerState& State = GetState();
+
+	SRG_IMGUI_LLM_SCOPE();
+	FScopeLock Lock(&State.NamesLock);
+	Index = State.Names.Add(Name);
+}
+
+void SrgImGuiProfiler::FScope::RecordEvent(uint32 NameIndex, bool IsBegin)
+{
+	using namespace SrgImGuiProfiler_Private;
+	FThreadRing& Ring = GetCurrentThreadRing();
+
+	const uint64 Position = Ring.WritePosition.load(std::memory_order_relaxed);
+	FEvent& Event		  = Ring.Events[Position & RING_INDEX_MASK];
+	Event.Cycles		  = FPlatformTime::Cycles64();
+	Event.NameIndex		  = NameIndex;
+	Event.IsBegin		  = IsBegin;
+	Ring.WritePosition.store(Position + 1, std::memory_order_release);
+}
+
+bool SrgImGuiProfiler::IsEnabled()
+{
+#if SRG_IMGUI_PROFILER_ENABLED
+	return GSrgImGuiProfilerEnabled;
+#else
+	return false;
+#endif
+}
+
+void SrgImGuiProfiler::SetEnabled(bool Enabled)
+{
+#if SRG_IMGUI_PROFILER_ENABLED
+	if (Enabled && !GSrgImGuiProfilerEnabled)
+	{
+		ResetWorstFrame();
+	}
+	CVarSrgImGuiProfilerEnabled->Set(Enabled, ECVF_SetByCode);
+#endif
+}
+
+void SrgImGuiProfiler::CollectFrame()
+{
+	using namespace SrgImGuiProfiler_Private;
+	check(IsInGameThread());
+
+	if (LastCollectionFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastCollectionFrame = GFrameCounter;
+
+	const uint64 CurrentCycles = FPlatformTime::Cycles64();
+	const uint64 StartCycles   = LastCollectionCycles > 0 ? LastCollectionCycles : CurrentCycles;
+	LastCollectionCycles	   = CurrentCycles;
+
+	TArray<FThreadRing*> Rings;
+	{
+		FProfilerState& State = GetState();
+		FScopeLock Lock(&State.RingsLock);
+		Rings = State.Rings;
+	}
+
+	SRG_IMGUI_LLM_SCOPE();
+	FFrameCapture Frame;
+	Frame.FrameNumber = GFrameCounter;
+	Frame.StartCycles = StartCycles;
+	Frame.EndCycles	  = CurrentCycles;
+	TArray<FThreadRing*, TInlineAllocator<8>> ExitedRings;
+	for (FThreadRing* Ring : Rings)
+	{
+		// Checked before reading, so that every event of an exited thread is published when the ring is read.
+		if (Ring->ThreadExited.load(std::memory_order_acquire))
+		{
+			ExitedRings.Add(Ring);
+		}
+
+		FThreadCapture Capture;
+		CollectRing(*Ring, Capture);
+		if (!Capture.Scopes.IsEmpty())
+		{
+			Capture.ThreadId   = Ring->ThreadId;
+			Capture.ThreadName = Ring->ThreadName;
+			Frame.Threads.Add(MoveTemp(Capture));
+		}
+	}
+
+	if (!ExitedRings.IsEmpty())
+	{
+		FProfilerState& State = GetState();
+		FScopeLock Lock(&State.RingsLock);
+		for (FThreadRing* Ring : ExitedRings)
+		{
+			State.Rings.RemoveSingle(Ring);
+			State.FreeRings.Add(Ring);
+		}
+	}
+
+	if (IsCaptureFrozen || Frame.Threads.IsEmpty())
+	{
+		return;
+	}
+
+	if (!WorstFrame.IsSet() || Frame.GetDurationMs() > WorstFrame->GetDurationMs())
+	{
+		WorstFrame = Frame;
+	}
+
+	if (Frames.Num() < MAX_FRAMES)
+	{
+		Frames.Add(MoveTemp(Frame));
+	}
+	else
+	{
+		Frames[NextFrameIndex] = MoveTemp(Frame);
+	}
+	NextFrameIndex = (NextFrameIndex + 1) % MAX_FRAMES;
+}
+
+bool SrgImGuiProfiler::IsFrozen()
+{
+	return SrgImGuiProfiler_Private::IsCaptureFrozen;
+}
+
+void SrgImGuiProfiler::SetFrozen(bool Frozen)
+{
+	SrgImGuiProfiler_Private::IsCaptureFrozen = Frozen;
+}
+
+int32 SrgImGuiProfiler::GetNumFrames()
+{
+	return SrgImGuiProfiler_Private::Frames.Num();
+}
+
+const SrgImGuiProfiler::FFrameCapture& SrgImGuiProfiler::GetFrame(int32 Age)
+{
+	using namespace SrgImGuiProfiler_Private;
+	check(Frames.IsValidIndex(Age));
+	const int32 LatestIndex = (NextFrameIndex - 1 + Frames.Num()) % Frames.Num();
+	return Frames[(LatestIndex - Age + Frames.Num()) % Frames.Num()];
+}
+
+const SrgImGuiProfiler::FFrameCapture* SrgImGuiProfiler::GetWorstFrame()
+{
+	using namespace SrgImGuiProfiler_Private;
+	return WorstFrame.IsSet() ? &WorstFrame.GetValue() : nullptr;
+}
+
+void SrgImGuiProfiler::ResetWorstFrame()
+{
+	SrgImGuiProfiler_Private::WorstFrame.Reset();
+}
+
+const TCHAR* SrgImGuiProfiler::GetScopeName(uint32 NameIndex)
+{
+	using namespace SrgImGuiProfiler_Private;
+	FProfilerState& State = GetState();
+
+	// Names are only ever added. The strings keep their buffers when the array grows, so the pointer stays valid.
+	FScopeLock Lock(&State.NamesLock);
+	return State.Names.IsValidIndex(NameIndex) ? *State.Names[NameIndex] : TEXT("Unknown");
+}
@@ -0,0 +1,281 @@
+// © Surgent Studios
+
+#include "Telemetry/SrgImGuiSubmissionQueue.h"
+
+#include <imgui.h>
+
+#include "SrgImGuiMemory.h"
+#include "SrgImGuiStringConversion.h"
+#include "SrgImGuiSubsystem.h"
+#include "Telemetry/SrgImGuiBoundedQueue.h"
+
+namespace SrgImGuiSubmission_Private
+{
+	static constexpr uint32 QUEUE_CAPACITY	 = 1024;
+	static constexpr int32 LABEL_BUFFER_SIZE = 32;
+	static constexpr int32 TEXT_BUFFER_SIZE	 = 128;
+	static constexpr int32 PLOT_NUM_SAMPLES	 = 128;
+	// Labels that are not submitted to for this long are forgotten, so that dynamic labels do not accumulate.
+	static constexpr uint64 ENTRY_LIFETIME_FRAMES = 600;
+
+	enum class ESubmissionType : uint8
+	{
+		Text,
+		Value,
+		PlotSample
+	};
+
+	struct FSubmission
+	{
+		FGameplayTag NodeTag;
+		ESubmissionType Type = ESubmissionType::Text;
+		double Value		 = 0.0;
+		TCHAR Label[LABEL_BUFFER_SIZE];
+		TCHAR Text[TEXT_BUFFER_SIZE];
+	};
+
+	struct FPlot
+	{
+		TArray<float> Samples;
+		int32 NextIndex = 0;
+	};
+
+	// Latest data submitted with a label.
+	struct FEntry
+	{
+		FString Label;
+		ESubmissionType Type = ESubmissionType::Text;
+		FString Text;
+		double Value = 0.0;
+		FPlot Plot;
+		uint64 LastSubmitFrame = 0;
+
+		SIZE_T GetAllocatedSize() const
+		{
+			return Label.GetAllocatedSize() + Text.GetAllocatedSize() + Plot.Samples.GetAllocatedSize();
+		}
+	};
+
+	// Latest data submitted to a draw tree node. Only accessed from the game thread.
+	// A node only has a few labels, so they are searched linearly, which needs no allocation to look a label up.
+	struct FNodeSubmissions
+	{
+		TArray<FEntry> Entries;
+
+		SIZE_T GetAllocatedSize() const
+		{
+			SIZE_T Size = Entries.GetAllocatedSize();
+			for (const FEntry& Entry : Entries)
+			{
+				Size += Entry.GetAllocatedSize();
+			}
+			return Size;
+		}
+	};
+
+	using FSubmissionQueue = TSrgImGuiBoundedQueue<FSubmission, QUEUE_CAPACITY>;
+
+	// Never destroyed, as producers on other threads may still submit during shutdown.
+	FSubmissionQueue& GetQueue()
+	{
+		static FSubmissionQueue& Queue = *[]()
+		{
+			SRG_IMGUI_LLM_SCOPE();
+			return new FSubmissionQueue();
+		}();
+		return Queue;
+	}
+
+	static std::atomic<uint32> NumDropped{0};
+	static TMap<FGameplayTag, FNodeSubmissions> NodeSubmissions;
+	static uint64 LastEvictionFrame = 0;
+
+	void CopyTruncated(TCHAR* Destination, int32 DestinationSize, FStringView Source)
+	{
+		const int32 Length = FMath::Min(Source.Len(), DestinationSize - 1);
+		FMemory::Memcpy(Destination, Source.GetData(), Length * sizeof(TCHAR));
+		Destination[Length] = TCHAR('\0');
+	}
+
+	template <typename WriteFunctorType>
+	bool Submit(const FGameplayTag& NodeTag, ESubmissionType Type, FStringView Label, WriteFunctorType&& WriteSubmission)
+	{
+		const bool WasSubmitted = GetQueue().TryEnqueue(
+			[&](FSubmission& Submission)
+			{
+				Submission.NodeTag = NodeTag;
+				Submission.Type	   = Type;
+				CopyTruncated(Submission.Label, LABEL_BUFFER_SIZE, Label);
+				WriteSubmission(Submission);
+			});
+
+		if (!WasSubmitted)
+		{
+			NumDropped.fetch_add(1, std::memory_order_relaxed);
+		}
+		return WasSubmitted;
+	}
+
+	FEntry& FindOrAddEntry(FNodeSubmissions& Node, const FSubmission& Submission)
+	{
+		for (FEntry& Entry : Node.Entries)
+		{
+			if (Entry.Type == Submission.Type && FCString::Strcmp(*Entry.Label, Submission.Label) == 0)
+			{
+				return Entry;
+			}
+		}
+
+		FEntry& Entry = Node.Entries.AddDefaulted_GetRef();
+		Entry.Label	  = Submission.Label;
+		Entry.Type	  = Submission.Type;
+		return Entry;
+	}
+
+	void ApplySubmission(const FSubmission& Submission)
+	{
+		FEntry& Entry		  = FindOrAddEntry(NodeSubmissions.FindOrAdd(Submission.NodeTag), Submission);
+		Entry.LastSubmitFrame = GFrameCounter;
+
+		switch (Submission.Type)
+		{
+			case ESubmissionType::Text:
+				Entry.Text = Submission.Text;
+				break;
+			case ESubmissionType::Value:
+				Entry.Value = Submission.Value;
+				break;
+			case ESubmissionType::PlotSample:
+			{
+				FPlot& Plot = Entry.Plot;
+				if (Plot.Samples.Num() < PLOT_NUM_SAMPLES)
+				{
+					Plot.Samples.Add(static_cast<float>(Submission.Value));
+				}
+				else
+				{
+					Plot.Samples[Plot.NextIndex] = static_cast<float>(Submission.Value);
+				}
+				Plot.NextIndex = (Plot.NextIndex + 1) % PLOT_NUM_SAMPLES;
+				break;
+			}
+		}
+	}
+
+	void EvictStaleEntries()
+	{
+		if (LastEvictionFrame == GFrameCounter)
+		{
+			return;
+		}
+		LastEvictionFrame = GFrameCounter;
+
+		for (auto It = NodeSubmissions.CreateIterator(); It; ++It)
+		{
+			It->Value.Entries.RemoveAll([](const FEntry& Entry)
+										{ return GFrameCounter - Entry.LastSubmitFrame > ENTRY_LIFETIME_FRAMES; });
+			if (It->Value.Entries.IsEmpty())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	static SrgImGuiMemory::FAutoRegisterGatherer SubmissionsGatherer(
+		[](SrgImGuiMemory::FReport& Report)
+		{
+			SIZE_T Size = FSubmissionQueue::GetAllocatedSize() + NodeSubmissions.GetAllocatedSize();
+			for (const TPair<FGameplayTag, FNodeSubmissions>& Pair : NodeSubmissions)
+			{
+				Size += Pair.Value.GetAllocatedSize();
+			}
+			Report.Add(SrgImGuiMemory::Category::SubmissionQueue, Size, NodeSubmissions.Num());
+		});
+}	 // namespace SrgImGuiSubmission_Private
+
+bool SrgImGuiSubmission::SubmitText(const FGameplayTag& NodeTag, FStringView Label, FStringView Text)
+{
+	using namespace SrgImGuiSubmission_Private;
+	return Submit(NodeTag, ESubmissionType::Text, Label,
+				  [Text](FSubmission& Submission) { CopyTruncated(Submission.Text, TEXT_BUFFER_SIZE, Text); });
+}
+
+bool SrgImGuiSubmission::SubmitValue(const FGameplayTag& NodeTag, FStringView Label, double Value)
+{
+	using namespace SrgImGuiSubmission_Private;
+	return Submit(NodeTag, ESubmissionType::Value, Label, [Value](FSubmission& Submission) { Submission.Value = Value; });
+}
+
+bool SrgImGuiSubmission::SubmitPlotSample(const FGameplayTag& NodeTag, FStringView Label, float Sample)
+{
+	using namespace SrgImGuiSubmission_Private;
+	return Submit(NodeTag, ESubmissionType::PlotSample, Label, [Sample](FSubmission& Submission) { Submission.Value = Sample; });
+}
+
+void SrgImGuiSubmission::DrainQueue()
+{
+	using namespace SrgImGuiSubmission_Private;
+	check(IsInGameThread());
+	SRG_IMGUI_LLM_SCOPE();
+
+	// Only what is already in the queue is drained so that busy producers cannot keep the game thread here.
+	for (uint32 Index = 0; Index < QUEUE_CAPACITY; ++Index)
+	{
+		if (!GetQueue().TryDequeue(ApplySubmission))
+		{
+			break;
+		}
+	}
+
+	EvictStaleEntries();
+
+	const uint32 NumDroppedSinceLastDrain = NumDropped.exchange(0, std::memory_order_relaxed);
+	if (NumDroppedSinceLastDrain > 0)
+	{
+		UE_LOG(LogSrgImGui, Warning, TEXT("%u ImGui submissions were dropped because the submission queue was full."),
+			   NumDroppedSinceLastDrain);
+	}
+}
+
+void SrgImGuiSubmission::DrawNodeSubmissions(const FGameplayTag& NodeTag)
+{
+	using namespace SrgImGuiSubmission_Private;
+
+	const FNodeSubmissions* Node = NodeSubmissions.Find(NodeTag);
+	if (!Node)
+	{
+		return;
+	}
+
+	for (const FEntry& Entry : Node->Entries)
+	{
+		if (Entry.Type == ESubmissionType::Text)
+		{
+			ImGui::Text("%s: %s", TO_IMGUI(*Entry.Label), TO_IMGUI(*Entry.Text));
+		}
+	}
+
+	for (const FEntry& Entry : Node->Entries)
+	{
+		if (Entry.Type == ESubmissionType::Value)
+		{
+			ImGui::Text("%s: %g", TO_IMGUI(*Entry.Label), Entry.Value);
+		}
+	}
+
+	for (const FEntry& Entry : Node->Entries)
+	{
+		if (Entry.Type == ESubmissionType::PlotSample)
+		{
+			const FPlot& Plot		 = Entry.Plot;
+			const int32 ValuesOffset = Plot.Samples.Num() < PLOT_NUM_SAMPLES ? 0 : Plot.NextIndex;
+			ImGui::PlotLines(TO_IMGUI(*Entry.Label), Plot.Samples.GetData(), Plot.Samples.Num(), ValuesOffset);
+		}
+	}
+}
+
+void SrgImGuiSubmission::ClearNodeSubmissions(const FGameplayTag& NodeTag)
+{
+	check(IsInGameThread());
+	SrgImGuiSubmission_Private::NodeSubmissions.Remove(NodeTag);
+}
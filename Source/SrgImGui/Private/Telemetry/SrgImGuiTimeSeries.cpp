@@ -0,0 +1,116 @@
+// © Surgent Studios
+
+#include "Telemetry/SrgImGuiTimeSeries.h"
+
+#include "SrgImGuiMemory.h"
+
+FSrgImGuiTimeSeries::FSrgImGuiTimeSeries(int32 InCapacity /*= 128*/)
+{
+	SetCapacity(InCapacity);
+}
+
+void FSrgImGuiTimeSeries::Push(float Sample)
+{
+	const int32 Capacity = Samples.Num();
+	if (NumSamples < Capacity)
+	{
+		Samples[NumSamples++] = Sample;
+	}
+	else
+	{
+		Samples[OldestIndex] = Sample;
+		OldestIndex			 = OldestIndex + 1 < Capacity ? OldestIndex + 1 : 0;
+	}
+	++Version;
+}
+
+void FSrgImGuiTimeSeries::Reset()
+{
+	NumSamples	= 0;
+	OldestIndex = 0;
+	++Version;
+}
+
+SrgImGuiPlot::FSamples FSrgImGuiTimeSeries::GetSamples() const
+{
+	SrgImGuiPlot::FSamples Out;
+	if (NumSamples < Samples.Num())
+	{
+		Out.First = TConstArrayView<float>(Samples.GetData(), NumSamples);
+	}
+	else
+	{
+		Out.First  = TConstArrayView<float>(Samples.GetData() + OldestIndex, Samples.Num() - OldestIndex);
+		Out.Second = TConstArrayView<float>(Samples.GetData(), OldestIndex);
+	}
+	return Out;
+}
+
+void FSrgImGuiTimeSeries::SetCapacity(int32 NewCapacity)
+{
+	SRG_IMGUI_LLM_SCOPE();
+	Samples.SetNumZeroed(FMath::Max(NewCapacity, 2));
+	Reset();
+}
+
+void SrgImGuiTimeSeries::Plot(const TCHAR* Label, TConstArrayView<const FSrgImGuiTimeSeries*> Series,
+							  const TCHAR* OverlayText /*= TEXT("")*/, FVector2D Size /*= FVector2D::ZeroVector*/,
+							  float Min /*= FLT_MAX*/, float Max /*= FLT_MAX*/)
+{
+	TArray<SrgImGuiPlot::FSeries, TInlineAllocator<8>> PlotSeries;
+	for (const FSrgImGuiTimeSeries* TimeSeries : Series)
+	{
+		if (TimeSeries)
+		{
+			SrgImGuiPlot::FSeries& OneSeries = PlotSeries.AddDefaulted_GetRef();
+			OneSeries.Samples				 = TimeSeries->GetSamples();
+			OneSeries.Name					 = *TimeSeries->Name;
+			OneSeries.Color					 = TimeSeries->Color;
+			OneSeries.Version				 = TimeSeries->GetVersion();
+		}
+	}
+
+	SrgImGuiPlot::FOptions Options;
+	Options.OverlayText = OverlayText;
+	Options.Size		= Size;
+	Options.Min			= Min;
+	Options.Max			= Max;
+	SrgImGuiPlot::Lines(Label, PlotSeries, Options);
+}
+
+USrgImGuiTimeSeries* USrgImGuiTimeSeries::CreateTimeSeries(UObject* Owner, const FString& Name, int32 Capacity /*= 128*/,
+														   FLinearColor Color /*= FLinearColor::Transparent*/)
+{
+	SRG_IMGUI_LLM_SCOPE();
+	USrgImGuiTimeSeries* TimeSeries = NewObject<USrgImGuiTimeSeries>(Owner ? Owner : GetTransientPackage());
+	TimeSeries->Series.Name			= Name;
+	TimeSeries->Series.Color		= Color;
+	TimeSeries->Series.SetCapacity(Capacity);
+	return TimeSeries;
+}
+
+void USrgImGuiTimeSeries::Push(float Sample)
+{
+	Series.Push(Sample);
+}
+
+void USrgImGuiTimeSeries::Reset()
+{
+	Series.Reset();
+}
+
+float USrgImGuiTimeSeries::GetLatest() const
+{
+	return Series.GetLatest();
+}
+
+int32 USrgImGuiTimeSeries::Num() const
+{
+	return Series.Num();
+}
+
+void USrgImGuiTimeSeries::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Series.GetAllocatedSize());
+}
@@ -4,14 +4,18 @@
 
 #include <imgui.h>
 
+#include "SrgImGuiMemory.h"
+#include "SrgImGuiStats.h"
 #include "SrgImGuiStringConversion.h"
 #include "Interfaces/SrgImGuiCustomDrawer.h"
+#include "TypeDrawer/SrgImGuiTypeDrawer_Bytes.h"
 #include "TypeDrawer/SrgImGuiTypeDrawer_Class.h"
 #include "TypeDrawer/SrgImGuiTypeDrawer_Container.h"
 #include "TypeDrawer/SrgImGuiTypeDrawer_Delegate.h"
 #include "TypeDrawer/SrgImGuiTypeDrawer_Enum.h"
 #include "TypeDrawer/SrgImGuiTypeDrawer_Object.h"
 #include "TypeDrawer/SrgImGuiTypeDrawer_Struct.h"
+#include "TypeDrawer/SrgImGuiTypeDrawer_Table.h"
 
 static const TMap<FFieldClass*, TFunction<bool(void*, int32, FProperty&, const SrgImGuiTypeDrawer_Private::FDrawingContext&)>>
 	DrawPropertyValuePerType{
@@ -57,6 +61,8 @@ namespace SrgImGuiTypeDrawer_Private
 	{
 		const FString UnsupportedText = FString::Printf(TEXT("Unsupported type (%s)"), *Property.GetClass()->GetName());
 		ImGui::TextColored(ImVec4(1.f, 1.f, 0.f, 1.f), "%s", TO_IMGUI(*UnsupportedText));
+
+		SrgImGuiTypeDrawer::OnUnsupportedProperty().Broadcast(Property);
 	}
 }	 // namespace SrgImGuiTypeDrawer_Private
 
@@ -100,12 +106,12 @@ bool SrgImGuiTypeDrawer_Private::DrawPropertyValue(void* ContainerPtr, FProperty
 {
 	check(Property);
 	check(ArrayIndex >= 0 && ArrayIndex < Property->ArrayDim);
+	SrgImGuiStats::CountPropertyDrawn();
 
 	bool WasModified = false;
 	ImGui::PushID(TO_IMGUI(*DrawingContext.FieldName));
 
-	const TFunction<bool(void*, int32, FProperty&, const FDrawingContext&)>* DrawFunction =
-		DrawPropertyValuePerType.Find(Property->GetClass());
+	const FDrawPropertyValueFunction* DrawFunction = FindDrawPropertyValueFunction(*Property);
 	if (DrawFunction)
 	{
 		WasModified = (*DrawFunction)(ContainerPtr, ArrayIndex, *Property, DrawingContext);
@@ -119,6 +125,28 @@ bool SrgImGuiTypeDrawer_Private::DrawPropertyValue(void* ContainerPtr, FProperty
 	return WasModified;
 }
 
+const SrgImGuiTypeDrawer_Private::FDrawPropertyValueFunction* SrgImGuiTypeDrawer_Private::FindDrawPropertyValueFunction(
+	const FProperty& Property)
+{
+	return DrawPropertyValuePerType.Find(Property.GetClass());
+}
+
+SrgImGuiTypeDrawer::FOnUnsupportedProperty& SrgImGuiTypeDrawer::OnUnsupportedProperty()
+{
+	static FOnUnsupportedProperty Delegate;
+	return Delegate;
+}
+
+int32 SrgImGuiTypeDrawer_Private::GetCollapsingHeaderFlags(const FDrawingContext& DrawingContext)
+{
+	// The headers on the path to a search match are kept open while searching.
+	if (DrawingContext.Search)
+	{
+		ImGui::SetNextItemOpen(true);
+	}
+	return DrawingContext.ExpandHeaders ? ImGuiTreeNodeFlags_DefaultOpen : ImGuiTreeNodeFlags_None;
+}
+
 bool SrgImGuiTypeDrawer::DrawEnumValue(uint8& Value, UEnum* Enum, bool Mutable)
 {
 	if (!Enum)
@@ -131,20 +159,54 @@ bool SrgImGuiTypeDrawer::DrawEnumValue(uint8& Value, UEnum* Enum, bool Mutable)
 	return SrgImGuiTypeDrawer_Private::DrawEnumValue(Value, Enum, Context);
 }
 
+bool SrgImGuiTypeDrawer::DrawBytesValue(TArrayView<uint8> Bytes, bool Mutable)
+{
+	SrgImGuiTypeDrawer_Private::FDrawingContext Context;
+	Context.Mutable = Mutable;
+	return SrgImGuiTypeDrawer_Private::DrawBytesValue(Bytes, Context);
+}
+
 bool SrgImGuiTypeDrawer::DrawClassValue(UClass*& Class, UClass* ParentClass, bool Mutable)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SrgImGui_DrawType);
+	CSV_SCOPED_TIMING_STAT(SrgImGui, DrawType);
+	SRG_IMGUI_LLM_SCOPE();
+
 	if (!ParentClass)
 	{
 		return false;
 	}
+	SrgImGuiStats::CountPropertyDrawn();
 
 	SrgImGuiTypeDrawer_Private::FDrawingContext Context;
 	Context.Mutable = Mutable;
 	return SrgImGuiTypeDrawer_Private::DrawClassValue(Class, ParentClass, Context);
 }
 
-bool SrgImGuiTypeDrawer::DrawStructValue(void* StructData, UScriptStruct* Struct, bool Mutable, bool HasCollapsingHeader)
+bool SrgImGuiTypeDrawer::DrawSoftClassValue(FSoftObjectPtr& SoftClass, UClass* MetaClass, bool Mutable)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SrgImGui_DrawType);
+	CSV_SCOPED_TIMING_STAT(SrgImGui, DrawType);
+	SRG_IMGUI_LLM_SCOPE();
+
+	if (!MetaClass)
+	{
+		return false;
+	}
+	SrgImGuiStats::CountPropertyDrawn();
+
+	SrgImGuiTypeDrawer_Private::FDrawingContext Context;
+	Context.Mutable = Mutable;
+	return SrgImGuiTypeDrawer_Private::DrawSoftClassValue(SoftClass, MetaClass, Context);
+}
+
+bool SrgImGuiTypeDrawer::DrawStructValue(void* StructData, UScriptStruct* Struct, bool Mutable, bool HasCollapsingHeader,
+										 bool ExpandHeaders /*= false*/, bool HasSearch /*= false*/)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SrgImGui_DrawType);
+	CSV_SCOPED_TIMING_STAT(SrgImGui, DrawType);
+	SRG_IMGUI_LLM_SCOPE();
+
 	if (!StructData || !Struct)
 	{
 		return false;
@@ -152,11 +214,35 @@ bool SrgImGuiTypeDrawer::DrawStructValue(void* StructData, UScriptStruct* Struct
 	SrgImGuiTypeDrawer_Private::FDrawingContext Context;
 	Context.Mutable				= Mutable;
 	Context.HasCollapsingHeader = HasCollapsingHeader;
+	Context.ExpandHeaders		= ExpandHeaders;
+	Context.HasSearch			= HasSearch;
 	return SrgImGuiTypeDrawer_Private::DrawStructValue(StructData, Struct, Context);
 }
 
-bool SrgImGuiTypeDrawer::DrawObjectValue(UObject* Object, bool HasCollapsingHeader, bool ForceDrawDefault /*= false*/)
+bool SrgImGuiTypeDrawer::DrawStructArrayValue(void* Base, int32 Count, int32 Stride, UScriptStruct* Struct, bool Mutable,
+											  bool HasCollapsingHeader)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SrgImGui_DrawType);
+	CSV_SCOPED_TIMING_STAT(SrgImGui, DrawType);
+	SRG_IMGUI_LLM_SCOPE();
+
+	if (!Struct || Count < 0 || (!Base && Count > 0) || Stride < Struct->GetStructureSize())
+	{
+		return false;
+	}
+	SrgImGuiTypeDrawer_Private::FDrawingContext Context;
+	Context.Mutable				= Mutable;
+	Context.HasCollapsingHeader = HasCollapsingHeader;
+	return SrgImGuiTypeDrawer_Private::DrawStructArrayValue(Base, Count, Stride, *Struct, Context);
+}
+
+bool SrgImGuiTypeDrawer::DrawObjectValue(UObject* Object, bool HasCollapsingHeader, bool ForceDrawDefault /*= false*/,
+										 bool ExpandHeaders /*= false*/, bool HasSearch /*= false*/)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SrgImGui_DrawType);
+	CSV_SCOPED_TIMING_STAT(SrgImGui, DrawType);
+	SRG_IMGUI_LLM_SCOPE();
+
 	if (!Object)
 	{
 		return false;
@@ -165,12 +251,18 @@ bool SrgImGuiTypeDrawer::DrawObjectValue(UObject* Object, bool HasCollapsingHead
 	Context.RootObjectClass		= Object->GetClass();
 	Context.HasCollapsingHeader = HasCollapsingHeader;
 	Context.ForceDrawDefault	= ForceDrawDefault;
+	Context.ExpandHeaders		= ExpandHeaders;
+	Context.HasSearch			= HasSearch;
 	return SrgImGuiTypeDrawer_Private::DrawObjectValue(Object, Object->GetClass(), Context);
 }
 
 bool SrgImGuiTypeDrawer::DrawPropertyValue(void* ContainerPtr, FProperty* Property, bool Mutable, bool HasCollapsingHeader,
 										   int32 ArrayIndex)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SrgImGui_DrawType);
+	CSV_SCOPED_TIMING_STAT(SrgImGui, DrawType);
+	SRG_IMGUI_LLM_SCOPE();
+
 	if (!ContainerPtr || !Property)
 	{
 		return false;
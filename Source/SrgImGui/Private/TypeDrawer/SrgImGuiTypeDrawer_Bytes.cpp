@@ -0,0 +1,328 @@
+// © Surgent Studios
+
+#include "TypeDrawer/SrgImGuiTypeDrawer_Bytes.h"
+
+#include <imgui.h>
+
+#include "Math/VectorRegister.h"
+
+#include "SrgImGuiMemory.h"
+
+namespace SrgImGuiTypeDrawer_Private
+{
+	static constexpr int32 BYTES_PER_ROW = 16;
+	// A row is "OOOOOOOO  HH HH HH HH HH HH HH HH  HH HH HH HH HH HH HH HH  AAAAAAAAAAAAAAAA".
+	static constexpr int32 HEX_COLUMN	   = 10;
+	static constexpr int32 ASCII_COLUMN	   = HEX_COLUMN + BYTES_PER_ROW * 3 + 2;
+	static constexpr int32 ROW_BUFFER_SIZE = ASCII_COLUMN + BYTES_PER_ROW + 1;
+
+	static constexpr int32 HEX_VISIBLE_ROWS				   = 16;
+	static constexpr int32 HEX_SEARCH_BUFFER_SIZE		   = 128;
+	static constexpr uint64 HEX_VIEW_STATE_LIFETIME_FRAMES = 120;
+
+	struct FHexViewState
+	{
+		uint64 LastUsedFrame = 0;
+
+		// The selected bytes are highlighted in both columns.
+		int32 SelectionStart   = INDEX_NONE;
+		int32 SelectionLength  = 0;
+		bool ScrollToSelection = false;
+
+		ANSICHAR GoToOffset[20]					= {};
+		ANSICHAR Search[HEX_SEARCH_BUFFER_SIZE] = {};
+		bool SearchText							= false;
+		bool NotFound							= false;
+	};
+
+	// Only accessed from the game thread.
+	static TMap<ImGuiID, FHexViewState> HexViewStates;
+	static uint64 LastHexViewEvictionFrame = 0;
+
+	static SrgImGuiMemory::FAutoRegisterGatherer HexViewStatesGatherer(
+		[](SrgImGuiMemory::FReport& Report)
+		{
+			Report.Add(SrgImGuiMemory::Category::ItemCaches, HexViewStates.GetAllocatedSize(), HexViewStates.Num());
+		});
+
+	FHexViewState& FindOrAddHexViewState(ImGuiID Id)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+
+		if (LastHexViewEvictionFrame != GFrameCounter)
+		{
+			LastHexViewEvictionFrame = GFrameCounter;
+			for (auto It = HexViewStates.CreateIterator(); It; ++It)
+			{
+				if (It->Value.LastUsedFrame + HEX_VIEW_STATE_LIFETIME_FRAMES < GFrameCounter)
+				{
+					It.RemoveCurrent();
+				}
+			}
+		}
+
+		FHexViewState& State = HexViewStates.FindOrAdd(Id);
+		State.LastUsedFrame	 = GFrameCounter;
+		return State;
+	}
+
+	// Turns every byte of the lanes, each holding a nibble (0-15), into its hex digit. No byte overflows into the next one, so
+	// each 32-bit lane works as four independent bytes.
+	VectorRegister4Int NibblesToHexDigits(const VectorRegister4Int& Nibbles)
+	{
+		// 1 in the bytes above 9, as adding 6 to them sets their fifth bit.
+		const VectorRegister4Int Shifted  = VectorShiftRightImmLogical(VectorIntAdd(Nibbles, VectorIntSet1(0x06060606)), 4);
+		const VectorRegister4Int IsLetter = VectorIntAnd(Shifted, VectorIntSet1(0x01010101));
+		// 'A' is 7 characters after '9' + 1.
+		const VectorRegister4Int LetterOffset = VectorIntSubtract(VectorShiftLeftImm(IsLetter, 3), IsLetter);
+		return VectorIntAdd(VectorIntAdd(Nibbles, VectorIntSet1(0x30303030)), LetterOffset);
+	}
+
+	// Formats the hex digits of a whole row at once.
+	void BytesToHexDigits(const uint8* Bytes, uint8* HighDigits, uint8* LowDigits)
+	{
+		const VectorRegister4Int NibbleMask = VectorIntSet1(0x0F0F0F0F);
+		const VectorRegister4Int Values		= VectorIntLoad(Bytes);
+		// Shifting the 32-bit lanes moves bits into the neighboring byte, which the mask clears.
+		VectorIntStore(NibblesToHexDigits(VectorIntAnd(VectorShiftRightImmLogical(Values, 4), NibbleMask)), HighDigits);
+		VectorIntStore(NibblesToHexDigits(VectorIntAnd(Values, NibbleMask)), LowDigits);
+	}
+
+	int32 GetHexColumn(int32 ByteInRow)
+	{
+		// The two halves of the row are separated by an extra space.
+		return HEX_COLUMN + ByteInRow * 3 + (ByteInRow >= BYTES_PER_ROW / 2 ? 1 : 0);
+	}
+
+	void FormatRow(TConstArrayView<uint8> RowBytes, int32 Offset, ANSICHAR (&Row)[ROW_BUFFER_SIZE])
+	{
+		static constexpr ANSICHAR HEX_DIGITS[] = "0123456789ABCDEF";
+
+		alignas(16) uint8 Bytes[BYTES_PER_ROW] = {};
+		alignas(16) uint8 HighDigits[BYTES_PER_ROW];
+		alignas(16) uint8 LowDigits[BYTES_PER_ROW];
+		FMemory::Memcpy(Bytes, RowBytes.GetData(), RowBytes.Num());
+		BytesToHexDigits(Bytes, HighDigits, LowDigits);
+
+		FMemory::Memset(Row, ' ', ROW_BUFFER_SIZE);
+		for (int32 Digit = 0; Digit < 8; ++Digit)
+		{
+			Row[Digit] = HEX_DIGITS[(Offset >> (28 - Digit * 4)) & 0xF];
+		}
+		for (int32 Index = 0; Index < RowBytes.Num(); ++Index)
+		{
+			const int32 Column = GetHexColumn(Index);
+			Row[Column]		   = HighDigits[Index];
+			Row[Column + 1]	   = LowDigits[Index];
+
+			const uint8 Byte		  = Bytes[Index];
+			Row[ASCII_COLUMN + Index] = Byte >= 0x20 && Byte < 0x7F ? static_cast<ANSICHAR>(Byte) : '.';
+		}
+		Row[ASCII_COLUMN + RowBytes.Num()] = '\0';
+	}
+
+	// Returns the byte of the row under the column, or INDEX_NONE.
+	int32 GetByteInRowAtColumn(int32 Column)
+	{
+		for (int32 Index = 0; Index < BYTES_PER_ROW; ++Index)
+		{
+			const int32 HexColumn = GetHexColumn(Index);
+			if ((Column >= HexColumn && Column < HexColumn + 2) || Column == ASCII_COLUMN + Index)
+			{
+				return Index;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	// Parses "DE AD BE EF" (spaces are optional) or takes the text as is. Returns false if the hex bytes are invalid.
+	bool ParsePattern(const FHexViewState& State, TArray<uint8>& OutPattern)
+	{
+		if (State.SearchText)
+		{
+			OutPattern.Append(reinterpret_cast<const uint8*>(State.Search), FCStringAnsi::Strlen(State.Search));
+			return true;
+		}
+
+		int32 NumDigits = 0;
+		for (const ANSICHAR* It = State.Search; *It; ++It)
+		{
+			if (*It == ' ')
+			{
+				continue;
+			}
+			if (!FCharAnsi::IsHexDigit(*It))
+			{
+				return false;
+			}
+			const uint8 Value = static_cast<uint8>(FParse::HexDigit(*It));
+			if (NumDigits++ % 2 == 0)
+			{
+				OutPattern.Add(Value << 4);
+			}
+			else
+			{
+				OutPattern.Last() |= Value;
+			}
+		}
+		return NumDigits % 2 == 0;
+	}
+
+	// Returns the offset of the first occurrence of the pattern at or after StartOffset, wrapping around, or INDEX_NONE.
+	int32 FindPattern(TConstArrayView<uint8> Bytes, TConstArrayView<uint8> Pattern, int32 StartOffset)
+	{
+		const int32 LastOffset = Bytes.Num() - Pattern.Num();
+		if (Pattern.IsEmpty() || LastOffset < 0)
+		{
+			return INDEX_NONE;
+		}
+
+		for (int32 Step = 0; Step <= LastOffset; ++Step)
+		{
+			const int32 Offset = (StartOffset + Step) % (LastOffset + 1);
+			if (Bytes[Offset] == Pattern[0] && FMemory::Memcmp(&Bytes[Offset], Pattern.GetData(), Pattern.Num()) == 0)
+			{
+				return Offset;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	void DrawHexViewToolbar(TConstArrayView<uint8> Bytes, FHexViewState& State)
+	{
+		ImGui::TextDisabled("%d bytes", Bytes.Num());
+
+		ImGui::SameLine();
+		ImGui::SetNextItemWidth(ImGui::GetFontSize() * 6.0f);
+		if (ImGui::InputTextWithHint("##GoTo", "Offset", State.GoToOffset, IM_ARRAYSIZE(State.GoToOffset),
+									 ImGuiInputTextFlags_CharsHexadecimal | ImGuiInputTextFlags_EnterReturnsTrue) &&
+			!Bytes.IsEmpty())
+		{
+			const uint64 Offset		= FCStringAnsi::Strtoui64(State.GoToOffset, nullptr, 16);
+			State.SelectionStart	= static_cast<int32>(FMath::Min<uint64>(Offset, Bytes.Num() - 1));
+			State.SelectionLength	= 1;
+			State.ScrollToSelection = true;
+		}
+
+		ImGui::SameLine();
+		ImGui::SetNextItemWidth(ImGui::GetFontSize() * 12.0f);
+		const bool SearchEntered = ImGui::InputTextWithHint("##Search", State.SearchText ? "Text" : "Hex (DE AD BE EF)",
+															State.Search, HEX_SEARCH_BUFFER_SIZE,
+															ImGuiInputTextFlags_EnterReturnsTrue);
+		ImGui::SameLine();
+		ImGui::Checkbox("Text", &State.SearchText);
+		ImGui::SameLine();
+		if (ImGui::Button("Find Next") || SearchEntered)
+		{
+			TArray<uint8> Pattern;
+			const int32 StartOffset = State.SelectionStart != INDEX_NONE ? State.SelectionStart + 1 : 0;
+			const int32 Found		= ParsePattern(State, Pattern) ? FindPattern(Bytes, Pattern, StartOffset) : INDEX_NONE;
+			State.NotFound			= Found == INDEX_NONE;
+			if (!State.NotFound)
+			{
+				State.SelectionStart	= Found;
+				State.SelectionLength	= Pattern.Num();
+				State.ScrollToSelection = true;
+			}
+		}
+		if (State.NotFound)
+		{
+			ImGui::SameLine();
+			ImGui::TextDisabled("Not found");
+		}
+	}
+
+	void DrawHexRows(TConstArrayView<uint8> Bytes, FHexViewState& State)
+	{
+		const float LineHeight = ImGui::GetTextLineHeightWithSpacing();
+		// The default font is monospaced, so every column has the width of a digit.
+		const float CharacterWidth = ImGui::CalcTextSize("0").x;
+		const int32 NumRows		   = FMath::DivideAndRoundUp(Bytes.Num(), BYTES_PER_ROW);
+		const ImU32 SelectionColor = ImGui::GetColorU32(ImGuiCol_TextSelectedBg);
+
+		const float ChildHeight = LineHeight * FMath::Min(NumRows, HEX_VISIBLE_ROWS) + ImGui::GetStyle().ScrollbarSize;
+		if (ImGui::BeginChild("##Rows", ImVec2(0.0f, ChildHeight), true, ImGuiWindowFlags_HorizontalScrollbar))
+		{
+			if (State.ScrollToSelection && State.SelectionStart != INDEX_NONE)
+			{
+				const float SelectionY = (State.SelectionStart / BYTES_PER_ROW) * LineHeight;
+				ImGui::SetScrollY(FMath::Max(0.0f, SelectionY - ImGui::GetWindowHeight() * 0.5f));
+			}
+			State.ScrollToSelection = false;
+
+			ImDrawList* DrawList = ImGui::GetWindowDrawList();
+			ANSICHAR Row[ROW_BUFFER_SIZE];
+			ImGuiListClipper Clipper;
+			Clipper.Begin(NumRows, LineHeight);
+			while (Clipper.Step())
+			{
+				for (int32 RowIndex = Clipper.DisplayStart; RowIndex < Clipper.DisplayEnd; ++RowIndex)
+				{
+					const int32 RowOffset = RowIndex * BYTES_PER_ROW;
+					const int32 NumBytes  = FMath::Min(BYTES_PER_ROW, Bytes.Num() - RowOffset);
+					FormatRow(Bytes.Slice(RowOffset, NumBytes), RowOffset, Row);
+
+					const ImVec2 RowPosition = ImGui::GetCursorScreenPos();
+					const int32 SelectionEnd = State.SelectionStart + State.SelectionLength;
+					for (int32 Index = 0; Index < NumBytes; ++Index)
+					{
+						if (RowOffset + Index >= State.SelectionStart && RowOffset + Index < SelectionEnd)
+						{
+							for (const int32 Column : {GetHexColumn(Index), ASCII_COLUMN + Index})
+							{
+								const float Width = Column < ASCII_COLUMN ? 2.0f : 1.0f;
+								const ImVec2 Min(RowPosition.x + Column * CharacterWidth, RowPosition.y);
+								DrawList->AddRectFilled(Min, ImVec2(Min.x + Width * CharacterWidth, Min.y + LineHeight),
+														SelectionColor);
+							}
+						}
+					}
+
+					ImGui::TextUnformatted(Row);
+					if (ImGui::IsItemClicked())
+					{
+						const int32 Column	  = static_cast<int32>((ImGui::GetMousePos().x - RowPosition.x) / CharacterWidth);
+						const int32 ByteInRow = GetByteInRowAtColumn(Column);
+						if (ByteInRow != INDEX_NONE && ByteInRow < NumBytes)
+						{
+							State.SelectionStart  = RowOffset + ByteInRow;
+							State.SelectionLength = 1;
+						}
+					}
+				}
+			}
+		}
+		ImGui::EndChild();
+	}
+}	 // namespace SrgImGuiTypeDrawer_Private
+
+bool SrgImGuiTypeDrawer_Private::DrawBytesValue(TArrayView<uint8> Bytes, const FDrawingContext& Context)
+{
+	FHexViewState& State = FindOrAddHexViewState(ImGui::GetID("##Bytes"));
+	if (State.SelectionStart >= Bytes.Num())
+	{
+		State.SelectionStart = INDEX_NONE;
+	}
+
+	ImGui::BeginGroup();
+	DrawHexViewToolbar(Bytes, State);
+	DrawHexRows(Bytes, State);
+
+	bool Modified = false;
+	if (State.SelectionStart != INDEX_NONE)
+	{
+		uint8& Selected = Bytes[State.SelectionStart];
+		ImGui::Text("0x%08X:", State.SelectionStart);
+		ImGui::SameLine();
+		if (Context.Mutable)
+		{
+			ImGui::SetNextItemWidth(ImGui::GetFontSize() * 3.0f);
+			Modified = ImGui::InputScalar("##Selected", ImGuiDataType_U8, &Selected, nullptr, nullptr, "%02X",
+										  ImGuiInputTextFlags_CharsHexadecimal);
+			ImGui::SameLine();
+		}
+		ImGui::TextDisabled("%u '%c'", Selected, Selected >= 0x20 && Selected < 0x7F ? Selected : '.');
+	}
+	ImGui::EndGroup();
+	return Modified;
+}
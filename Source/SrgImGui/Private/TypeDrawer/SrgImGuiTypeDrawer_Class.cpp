@@ -82,15 +82,10 @@ bool SrgImGuiTypeDrawer_Private::DrawClassPropertyValue(void* ContainerPtr, int3
 	return false;
 }
 
-bool SrgImGuiTypeDrawer_Private::DrawSoftClassPropertyValue(void* ContainerPtr, int32 ArrayIndex, FProperty& Property,
-															const FDrawingContext& Context)
+bool SrgImGuiTypeDrawer_Private::DrawSoftClassValue(FSoftObjectPtr& SoftClass, UClass* MetaClass, const FDrawingContext& Context)
 {
-	check(Property.IsA<FSoftClassProperty>());
-	FSoftClassProperty* SoftClassProperty = CastField<FSoftClassProperty>(&Property);
-	FSoftObjectPtr SoftClass			  = SoftClassProperty->GetPropertyValue_InContainer(ContainerPtr, ArrayIndex);
-	UClass* Class						  = Cast<UClass>(SoftClass.Get());
-	UClass* MetaClass					  = SoftClassProperty->MetaClass;
 	check(MetaClass);
+	UClass* Class = Cast<UClass>(SoftClass.Get());
 
 	bool Modified = false;
 
@@ -125,11 +120,11 @@ bool SrgImGuiTypeDrawer_Private::DrawSoftClassPropertyValue(void* ContainerPtr,
 		if (ImGui::CollapsingHeader("Modify"))
 		{
 			ImGui::Indent();
-			TOptional<UClass*> NewClass = DrawClassValue_Internal(Class, SoftClassProperty->MetaClass, Context);
+			TOptional<UClass*> NewClass = DrawClassValue_Internal(Class, MetaClass, Context);
 			if (NewClass.IsSet())
 			{
-				SoftClassProperty->SetObjectPropertyValue_InContainer(ContainerPtr, NewClass.GetValue(), ArrayIndex);
-				Modified = true;
+				SoftClass = NewClass.GetValue();
+				Modified  = true;
 			}
 			ImGui::Unindent();
 		}
@@ -137,3 +132,12 @@ bool SrgImGuiTypeDrawer_Private::DrawSoftClassPropertyValue(void* ContainerPtr,
 
 	return Modified;
 }
+
+bool SrgImGuiTypeDrawer_Private::DrawSoftClassPropertyValue(void* ContainerPtr, int32 ArrayIndex, FProperty& Property,
+															const FDrawingContext& Context)
+{
+	check(Property.IsA<FSoftClassProperty>());
+	FSoftClassProperty* SoftClassProperty = CastField<FSoftClassProperty>(&Property);
+	FSoftObjectPtr* SoftClass			  = Property.ContainerPtrToValuePtr<FSoftObjectPtr>(ContainerPtr, ArrayIndex);
+	return DrawSoftClassValue(*SoftClass, SoftClassProperty->MetaClass, Context);
+}
@@ -4,12 +4,402 @@
 
 #include <imgui.h>
 
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+
+#include "SrgImGuiMemory.h"
+#include "SrgImGuiStats.h"
 #include "SrgImGuiStringConversion.h"
 #include "TypeDrawer/SrgImGuiTypeDrawer.h"
+#include "TypeDrawer/SrgImGuiTypeDrawer_Bytes.h"
+#include "TypeDrawer/SrgImGuiTypeDrawer_Table.h"
 
 namespace SrgImGuiTypeDrawer_Private
 {
+	// Smaller containers are quick enough to read without sorting or filtering them.
+	static constexpr int32 CONTAINER_VIEW_MIN_ELEMENTS		 = 16;
+	static constexpr uint64 CONTAINER_VIEW_LIFETIME_FRAMES	 = 120;
+	static constexpr int32 CONTAINER_VIEW_FILTER_BUFFER_SIZE = 64;
+
+	enum class EContainerSort : uint8
+	{
+		None,
+		Ascending,
+		Descending,
+	};
+
+	// "> 10", "<= 0.5", "!= None", "== Sword" or text that the value must contain.
+	struct FContainerFilter
+	{
+		enum class EOperator : uint8
+		{
+			Contains,
+			Less,
+			LessEqual,
+			Greater,
+			GreaterEqual,
+			Equal,
+			NotEqual,
+		};
+
+		EOperator Operator = EOperator::Contains;
+		FString Value;
+		double Number	   = 0.0;
+		bool ValueIsNumber = false;
+
+		bool IsActive() const { return !Value.IsEmpty(); }
+
+		void Parse(const ANSICHAR* Text)
+		{
+			static const TPair<const TCHAR*, EOperator> OPERATORS[] = {
+				{TEXT(">="), EOperator::GreaterEqual}, {TEXT("<="), EOperator::LessEqual}, {TEXT("!="), EOperator::NotEqual},
+				{TEXT("=="), EOperator::Equal},		   {TEXT(">"), EOperator::Greater},	   {TEXT("<"), EOperator::Less},
+				{TEXT("="), EOperator::Equal},
+			};
+
+			Value	 = FString(UTF8_TO_TCHAR(Text)).TrimStartAndEnd();
+			Operator = EOperator::Contains;
+			for (const TPair<const TCHAR*, EOperator>& Pair : OPERATORS)
+			{
+				if (Value.StartsWith(Pair.Key))
+				{
+					Operator = Pair.Value;
+					Value	 = Value.RightChop(FCString::Strlen(Pair.Key)).TrimStart();
+					break;
+				}
+			}
+			ValueIsNumber = FCString::IsNumeric(*Value);
+			Number		  = ValueIsNumber ? FCString::Atod(*Value) : 0.0;
+		}
+
+		bool Passes(const FSortKey& Key) const
+		{
+			if (!IsActive())
+			{
+				return true;
+			}
+			if (Operator == EOperator::Contains)
+			{
+				return Key.IsNumber ? LexToSanitizedString(Key.Number).Contains(Value) : Key.Text.Contains(Value);
+			}
+
+			int32 Comparison = 0;
+			if (Key.IsNumber && ValueIsNumber)
+			{
+				Comparison = Key.Number < Number ? -1 : (Key.Number > Number ? 1 : 0);
+			}
+			else
+			{
+				Comparison = Key.Text.Compare(Value, ESearchCase::IgnoreCase);
+			}
+
+			switch (Operator)
+			{
+			case EOperator::Less:
+				return Comparison < 0;
+			case EOperator::LessEqual:
+				return Comparison <= 0;
+			case EOperator::Greater:
+				return Comparison > 0;
+			case EOperator::GreaterEqual:
+				return Comparison >= 0;
+			case EOperator::Equal:
+				return Comparison == 0;
+			default:
+				return Comparison != 0;
+			}
+		}
+	};
+
+	// The value the elements are sorted and filtered by: one of the properties stored in each element (e.g. the key or the value
+	// of a map pair), or a field of it when it is a struct.
+	struct FContainerKey
+	{
+		const FProperty* ElementProperty = nullptr;
+		const FProperty* Field			 = nullptr;
+
+		const FProperty& GetProperty() const { return Field ? *Field : *ElementProperty; }
+
+		const void* GetValuePtr(const void* ElementPtr) const
+		{
+			const void* ValuePtr = ElementProperty->ContainerPtrToValuePtr<void>(ElementPtr);
+			return Field ? Field->ContainerPtrToValuePtr<void>(ValuePtr) : ValuePtr;
+		}
+	};
+
+	// The elements of a container that pass its filter, in sorted order. The keys and the hash of each element key are kept so
+	// that, when a few elements change, only those are filtered and inserted again instead of sorting every element.
+	struct FContainerView
+	{
+		uint64 LastUsedFrame = 0;
+
+		int32 KeyElementProperty = 0;
+		FName KeyField;
+		EContainerSort Sort = EContainerSort::None;
+		ANSICHAR FilterText[CONTAINER_VIEW_FILTER_BUFFER_SIZE] = {};
+		FContainerFilter Filter;
+
+		// Cleared when the key, the sort or the filter changes.
+		bool Valid			= false;
+		uint32 ContentsHash = 0;
+		TArray<uint32> KeyHashes;
+		TArray<FSortKey> Keys;
+		// The indices of the elements to draw.
+		TArray<int32> Indices;
+
+		bool IsActive() const { return Sort != EContainerSort::None || Filter.IsActive(); }
+
+		// Equal keys keep the storage order, so the order is stable.
+		bool Less(int32 A, int32 B) const
+		{
+			if (Sort == EContainerSort::Ascending && (Keys[A] < Keys[B] || Keys[B] < Keys[A]))
+			{
+				return Keys[A] < Keys[B];
+			}
+			if (Sort == EContainerSort::Descending && (Keys[A] < Keys[B] || Keys[B] < Keys[A]))
+			{
+				return Keys[B] < Keys[A];
+			}
+			return A < B;
+		}
+
+		SIZE_T GetAllocatedSize() const
+		{
+			SIZE_T Size = KeyHashes.GetAllocatedSize() + Keys.GetAllocatedSize() + Indices.GetAllocatedSize();
+			for (const FSortKey& Key : Keys)
+			{
+				Size += Key.Text.GetAllocatedSize();
+			}
+			return Size;
+		}
+	};
+
+	// Only accessed from the game thread. The views are allocated separately so that the one being drawn stays valid when an
+	// element draws another large container, which can add a view and reallocate the map.
+	static TMap<ImGuiID, TUniquePtr<FContainerView>> ContainerViews;
+	static uint64 LastContainerViewEvictionFrame = 0;
+
+	static SrgImGuiMemory::FAutoRegisterGatherer ContainerViewsGatherer(
+		[](SrgImGuiMemory::FReport& Report)
+		{
+			SIZE_T Size = ContainerViews.GetAllocatedSize();
+			for (const TPair<ImGuiID, TUniquePtr<FContainerView>>& Pair : ContainerViews)
+			{
+				Size += Pair.Value->GetAllocatedSize();
+			}
+			Report.Add(SrgImGuiMemory::Category::ItemCaches, Size, ContainerViews.Num());
+		});
+
+	FContainerView& FindOrAddContainerView(ImGuiID Id)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+
+		if (LastContainerViewEvictionFrame != GFrameCounter)
+		{
+			LastContainerViewEvictionFrame = GFrameCounter;
+			for (auto It = ContainerViews.CreateIterator(); It; ++It)
+			{
+				if (It->Value->LastUsedFrame + CONTAINER_VIEW_LIFETIME_FRAMES < GFrameCounter)
+				{
+					It.RemoveCurrent();
+				}
+			}
+		}
+
+		TUniquePtr<FContainerView>& View = ContainerViews.FindOrAdd(Id);
+		if (!View)
+		{
+			View = MakeUnique<FContainerView>();
+		}
+		View->LastUsedFrame = GFrameCounter;
+		return *View;
+	}
+
+	const TCHAR* GetElementPropertyLabel(int32 ElementPropertyIndex, int32 NumElementProperties)
+	{
+		if (NumElementProperties == 1)
+		{
+			return TEXT("Element");
+		}
+		return ElementPropertyIndex == 0 ? TEXT("Key") : TEXT("Value");
+	}
+
+	TOptional<FContainerKey> ResolveContainerKey(const FContainerView& View, TConstArrayView<const FProperty*> ElementProperties)
+	{
+		if (!ElementProperties.IsValidIndex(View.KeyElementProperty))
+		{
+			return {};
+		}
+
+		FContainerKey Key;
+		Key.ElementProperty = ElementProperties[View.KeyElementProperty];
+		if (!View.KeyField.IsNone())
+		{
+			const FStructProperty* StructProperty = CastField<FStructProperty>(Key.ElementProperty);
+			Key.Field = StructProperty ? StructProperty->Struct->FindPropertyByName(View.KeyField) : nullptr;
+			if (!Key.Field)
+			{
+				return {};
+			}
+		}
+		return Key;
+	}
+
+	void DrawContainerViewControls(FContainerView& View, TConstArrayView<const FProperty*> ElementProperties)
+	{
+		static const char* SORT_LABELS[] = {"Unsorted", "Ascending", "Descending"};
+
+		ImGui::SetNextItemWidth(ImGui::GetFontSize() * 7.0f);
+		if (ImGui::BeginCombo("##Sort", SORT_LABELS[static_cast<int32>(View.Sort)]))
+		{
+			for (int32 Sort = 0; Sort < UE_ARRAY_COUNT(SORT_LABELS); ++Sort)
+			{
+				if (ImGui::Selectable(SORT_LABELS[Sort], Sort == static_cast<int32>(View.Sort)))
+				{
+					View.Sort  = static_cast<EContainerSort>(Sort);
+					View.Valid = false;
+				}
+			}
+			ImGui::EndCombo();
+		}
+
+		ImGui::SameLine();
+		const TCHAR* ElementLabel		   = GetElementPropertyLabel(View.KeyElementProperty, ElementProperties.Num());
+		const TOptional<FContainerKey> Key = ResolveContainerKey(View, ElementProperties);
+		const FString KeyLabel			   = Key.IsSet() && Key->Field
+												 ? FString::Printf(TEXT("%s.%s"), ElementLabel, *Key->Field->GetAuthoredName())
+												 : FString(ElementLabel);
+		ImGui::SetNextItemWidth(ImGui::GetFontSize() * 10.0f);
+		if (ImGui::BeginCombo("##Key", TO_IMGUI(*KeyLabel), ImGuiComboFlags_HeightLarge))
+		{
+			for (int32 Index = 0; Index < ElementProperties.Num(); ++Index)
+			{
+				const TCHAR* Label = GetElementPropertyLabel(Index, ElementProperties.Num());
+				if (ImGui::Selectable(TO_IMGUI(Label), Index == View.KeyElementProperty && View.KeyField.IsNone()))
+				{
+					View.KeyElementProperty = Index;
+					View.KeyField			= NAME_None;
+					View.Valid				= false;
+				}
+
+				const FStructProperty* StructProperty = CastField<FStructProperty>(ElementProperties[Index]);
+				if (!StructProperty)
+				{
+					continue;
+				}
+				for (TFieldIterator<FProperty> PropIt(StructProperty->Struct); PropIt; ++PropIt)
+				{
+					if (PropIt->ArrayDim != 1)
+					{
+						continue;
+					}
+					const FString FieldLabel = FString::Printf(TEXT("%s.%s"), Label, *PropIt->GetAuthoredName());
+					const bool IsSelected	 = Index == View.KeyElementProperty && PropIt->GetFName() == View.KeyField;
+					if (ImGui::Selectable(TO_IMGUI(*FieldLabel), IsSelected))
+					{
+						View.KeyElementProperty = Index;
+						View.KeyField			= PropIt->GetFName();
+						View.Valid				= false;
+					}
+				}
+			}
+			ImGui::EndCombo();
+		}
+
+		ImGui::SameLine();
+		ImGui::SetNextItemWidth(ImGui::GetFontSize() * 10.0f);
+		if (ImGui::InputTextWithHint("##Filter", "Filter (> 10, Sword)", View.FilterText, CONTAINER_VIEW_FILTER_BUFFER_SIZE))
+		{
+			View.Filter.Parse(View.FilterText);
+			View.Valid = false;
+		}
+	}
+
+	// Elements drawn on a single line all have the same height, which the clipper needs to skip the hidden ones. The other
+	// drawers can expand (e.g. a struct header opened by the user or by a search), which is only known by drawing them.
+	bool IsSingleLineProperty(const FProperty& Property)
+	{
+		return Property.IsA<FNumericProperty>() || Property.IsA<FBoolProperty>() || Property.IsA<FEnumProperty>() ||
+			   Property.IsA<FNameProperty>();
+	}
+
+	// Re-filters and re-inserts only the elements whose key hash changed since the last update, unless most of them did.
+	void UpdateContainerView(FContainerView& View, const FContainerKey& Key, int32 ContainerSize,
+							 const TFunction<void*(int32)>& GetElementPtr)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+
+		const FProperty& KeyProperty = Key.GetProperty();
+		// Hashing the memory of a key would miss the changes behind its pointers (e.g. the characters of a string), so keys
+		// without a value hash are sorted again every update.
+		const bool CanHashKeys = KeyProperty.HasAllPropertyFlags(CPF_HasGetValueTypeHash);
+		static TArray<uint32> KeyHashes;
+		KeyHashes.Reset();
+		TBitArray<> Changed(false, ContainerSize);
+		int32 NumChanged = ContainerSize;
+		if (CanHashKeys)
+		{
+			KeyHashes.SetNumUninitialized(ContainerSize);
+			uint32 ContentsHash = ContainerSize;
+			for (int32 Index = 0; Index < ContainerSize; ++Index)
+			{
+				KeyHashes[Index] = KeyProperty.GetValueTypeHash(Key.GetValuePtr(GetElementPtr(Index)));
+				ContentsHash	 = HashCombineFast(ContentsHash, KeyHashes[Index]);
+			}
+			if (View.Valid && View.ContentsHash == ContentsHash && View.KeyHashes.Num() == ContainerSize)
+			{
+				return;
+			}
+			View.ContentsHash = ContentsHash;
+
+			NumChanged = FMath::Max(0, View.KeyHashes.Num() - ContainerSize);
+			for (int32 Index = 0; Index < ContainerSize; ++Index)
+			{
+				if (!View.KeyHashes.IsValidIndex(Index) || View.KeyHashes[Index] != KeyHashes[Index])
+				{
+					Changed[Index] = true;
+					++NumChanged;
+				}
+			}
+		}
+
+		View.Keys.SetNum(ContainerSize);
+		if (!View.Valid || !CanHashKeys || NumChanged > ContainerSize / 4)
+		{
+			View.Indices.Reset();
+			for (int32 Index = 0; Index < ContainerSize; ++Index)
+			{
+				GetSortKey(KeyProperty, Key.GetValuePtr(GetElementPtr(Index)), View.Keys[Index]);
+				if (View.Filter.Passes(View.Keys[Index]))
+				{
+					View.Indices.Add(Index);
+				}
+			}
+			Algo::StableSort(View.Indices, [&View](int32 A, int32 B) { return View.Less(A, B); });
+		}
+		else
+		{
+			View.Indices.RemoveAll([&Changed, ContainerSize](int32 Index) { return Index >= ContainerSize || Changed[Index]; });
+			for (TConstSetBitIterator<> It(Changed); It; ++It)
+			{
+				const int32 Index = It.GetIndex();
+				GetSortKey(KeyProperty, Key.GetValuePtr(GetElementPtr(Index)), View.Keys[Index]);
+				if (View.Filter.Passes(View.Keys[Index]))
+				{
+					const int32 Position =
+						Algo::UpperBound(View.Indices, Index, [&View](int32 A, int32 B) { return View.Less(A, B); });
+					View.Indices.Insert(Index, Position);
+				}
+			}
+		}
+
+		Swap(View.KeyHashes, KeyHashes);
+		View.Valid = true;
+	}
+
 	bool DrawContainerPropertyValue(bool HasInnerArray, const FString& CollapsingHeaderTitle, int32 ContainerSize,
+									const TFunction<void*(int32)>& GetElementPtr,
+									TConstArrayView<const FProperty*> ElementProperties,
 									const TFunction<bool(int32, const FDrawingContext&)>& DrawAtIndex,
 									const TFunction<void()>& AddDefault, const TFunction<void(int32)>& RemoveAtIndex,
 									const FDrawingContext& Context)
@@ -25,7 +415,7 @@ namespace SrgImGuiTypeDrawer_Private
 		bool ShowInnerContent = true;
 		if (Context.HasCollapsingHeader)
 		{
-			ShowInnerContent = ImGui::CollapsingHeader(TO_IMGUI(*CollapsingHeaderTitle));
+			ShowInnerContent = ImGui::CollapsingHeader(TO_IMGUI(*CollapsingHeaderTitle), GetCollapsingHeaderFlags(Context));
 		}
 
 		if (!ShowInnerContent)
@@ -38,15 +428,34 @@ namespace SrgImGuiTypeDrawer_Private
 			ImGui::Indent();
 		}
 
+		// Large containers can be sorted and filtered by a key. Small ones are drawn in storage order.
+		const FContainerView* View = nullptr;
+		if (ContainerSize >= CONTAINER_VIEW_MIN_ELEMENTS)
+		{
+			FContainerView& ContainerView = FindOrAddContainerView(ImGui::GetID("##ContainerView"));
+			DrawContainerViewControls(ContainerView, ElementProperties);
+			const TOptional<FContainerKey> Key = ResolveContainerKey(ContainerView, ElementProperties);
+			if (ContainerView.IsActive() && Key.IsSet())
+			{
+				UpdateContainerView(ContainerView, Key.GetValue(), ContainerSize, GetElementPtr);
+				View = &ContainerView;
+				ImGui::SameLine();
+				ImGui::TextDisabled("%d of %d", View->Indices.Num(), ContainerSize);
+			}
+		}
+
 		bool Modified = false;
 		FDrawingContext NewContext(Context);
 		NewContext.HasCollapsingHeader = true;
 
-		int32 IndexToRemove = INDEX_NONE;
-		for (int32 Index = 0; Index < ContainerSize; ++Index)
+		int32 IndexToRemove		 = INDEX_NONE;
+		const int32 NumPositions = View ? View->Indices.Num() : ContainerSize;
+		auto DrawPosition		 = [&](int32 Position)
 		{
+			const int32 Index		= View ? View->Indices[Position] : Position;
 			const FString ElementId = FString::Printf(TEXT("%s[%d]"), *Context.FieldName, Index);
 			ImGui::PushID(TO_IMGUI(*ElementId));
+			SrgImGuiStats::CountContainerElementDrawn();
 
 			ImGui::Text("[%d]", Index);
 			ImGui::SameLine();
@@ -63,6 +472,26 @@ namespace SrgImGuiTypeDrawer_Private
 			Modified |= DrawAtIndex(Index, NewContext);
 
 			ImGui::PopID();
+		};
+
+		if (ElementProperties.Num() == 1 && IsSingleLineProperty(*ElementProperties[0]))
+		{
+			ImGuiListClipper Clipper;
+			Clipper.Begin(NumPositions);
+			while (Clipper.Step())
+			{
+				for (int32 Position = Clipper.DisplayStart; Position < Clipper.DisplayEnd; ++Position)
+				{
+					DrawPosition(Position);
+				}
+			}
+		}
+		else
+		{
+			for (int32 Position = 0; Position < NumPositions; ++Position)
+			{
+				DrawPosition(Position);
+			}
 		}
 
 		if (Context.Mutable)
@@ -101,6 +530,31 @@ bool SrgImGuiTypeDrawer_Private::DrawArrayPropertyValue(void* ContainerPtr, int3
 						*ArrayProperty->Inner->GetCPPType());
 	const int32 ContainerSize = ArrayHelper.Num();
 
+	// Byte arrays are usually raw buffers, which read better as a hex dump than as one line per element.
+	const FByteProperty* ByteProperty = CastField<FByteProperty>(ArrayProperty->Inner);
+	if (ByteProperty && !ByteProperty->Enum && !HasInnerArray)
+	{
+		if (Context.HasCollapsingHeader &&
+			!ImGui::CollapsingHeader(TO_IMGUI(*CollapsingHeaderTitle), GetCollapsingHeaderFlags(Context)))
+		{
+			return false;
+		}
+
+		if (Context.HasCollapsingHeader)
+		{
+			ImGui::Indent();
+		}
+		const bool Modified = DrawBytesValue(TArrayView<uint8>(ArrayHelper.GetRawPtr(), ContainerSize), Context);
+		if (Context.HasCollapsingHeader)
+		{
+			ImGui::Unindent();
+		}
+		return Modified;
+	}
+
+	TFunction<void*(int32)> GetElementPtr = [&ArrayHelper](int32 Index) { return ArrayHelper.GetElementPtr(Index); };
+	const FProperty* ElementProperties[]  = {ArrayProperty->Inner};
+
 	TFunction<bool(int32, const FDrawingContext&)> DrawAtIndex = [&ArrayHelper, &ArrayProperty](
 																	 int32 Index, const FDrawingContext& NewContext) {
 		return SrgImGuiTypeDrawer_Private::DrawPropertyValue(ArrayHelper.GetElementPtr(Index), ArrayProperty->Inner, 0,
@@ -109,8 +563,8 @@ bool SrgImGuiTypeDrawer_Private::DrawArrayPropertyValue(void* ContainerPtr, int3
 	TFunction<void()> AddDefault		 = [&ArrayHelper]() { ArrayHelper.AddValue(); };
 	TFunction<void(int32)> RemoveAtIndex = [&ArrayHelper](int32 Index) { ArrayHelper.RemoveValues(Index); };
 
-	return DrawContainerPropertyValue(HasInnerArray, CollapsingHeaderTitle, ContainerSize, DrawAtIndex, AddDefault, RemoveAtIndex,
-									  Context);
+	return DrawContainerPropertyValue(HasInnerArray, CollapsingHeaderTitle, ContainerSize, GetElementPtr, ElementProperties,
+									  DrawAtIndex, AddDefault, RemoveAtIndex, Context);
 }
 
 bool SrgImGuiTypeDrawer_Private::DrawSetPropertyValue(void* ContainerPtr, int32 ArrayIndex, FProperty& Property,
@@ -126,17 +580,31 @@ bool SrgImGuiTypeDrawer_Private::DrawSetPropertyValue(void* ContainerPtr, int32
 						SetHelper.Num(), *SetProperty->ElementProp->GetCPPType());
 	const int32 ContainerSize = SetHelper.Num();
 
+	// Finding the nth element walks the sparse storage, so the storage index of every element is found once.
+	TArray<int32, TInlineAllocator<64>> InternalIndices;
+	InternalIndices.Reserve(ContainerSize);
+	for (int32 InternalIndex = 0; InternalIndex < SetHelper.GetMaxIndex(); ++InternalIndex)
+	{
+		if (SetHelper.IsValidIndex(InternalIndex))
+		{
+			InternalIndices.Add(InternalIndex);
+		}
+	}
+
+	TFunction<void*(int32)> GetElementPtr = [&SetHelper, &InternalIndices](int32 Index)
+	{ return SetHelper.GetElementPtr(InternalIndices[Index]); };
+	const FProperty* ElementProperties[] = {SetProperty->ElementProp};
+
 	TFunction<bool(int32, const FDrawingContext&)> DrawAtIndex =
-		[&SetHelper, &SetProperty](int32 Index, const FDrawingContext& NewContext)
+		[&GetElementPtr, &SetProperty](int32 Index, const FDrawingContext& NewContext)
 	{
-		return SrgImGuiTypeDrawer_Private::DrawPropertyValue(SetHelper.FindNthElementPtr(Index), SetProperty->ElementProp, 0,
-															 NewContext);
+		return SrgImGuiTypeDrawer_Private::DrawPropertyValue(GetElementPtr(Index), SetProperty->ElementProp, 0, NewContext);
 	};
 	TFunction<void()> AddDefault		 = [&SetHelper]() { SetHelper.AddDefaultValue_Invalid_NeedsRehash(); };
 	TFunction<void(int32)> RemoveAtIndex = [&SetHelper](int32 Index) { SetHelper.RemoveAt(SetHelper.FindInternalIndex(Index)); };
 
-	const bool Modified = DrawContainerPropertyValue(HasInnerArray, CollapsingHeaderTitle, ContainerSize, DrawAtIndex, AddDefault,
-													 RemoveAtIndex, Context);
+	const bool Modified = DrawContainerPropertyValue(HasInnerArray, CollapsingHeaderTitle, ContainerSize, GetElementPtr,
+													 ElementProperties, DrawAtIndex, AddDefault, RemoveAtIndex, Context);
 	if (Modified)
 	{
 		SetHelper.Rehash();
@@ -156,10 +624,25 @@ bool SrgImGuiTypeDrawer_Private::DrawMapPropertyValue(void* ContainerPtr, int32
 						MapHelper.Num(), *MapProperty->KeyProp->GetCPPType(), *MapProperty->ValueProp->GetCPPType());
 	const int32 ContainerSize			= MapHelper.Num();
 
+	// Finding the nth pair walks the sparse storage, so the storage index of every pair is found once.
+	TArray<int32, TInlineAllocator<64>> InternalIndices;
+	InternalIndices.Reserve(ContainerSize);
+	for (int32 InternalIndex = 0; InternalIndex < MapHelper.GetMaxIndex(); ++InternalIndex)
+	{
+		if (MapHelper.IsValidIndex(InternalIndex))
+		{
+			InternalIndices.Add(InternalIndex);
+		}
+	}
+
+	TFunction<void*(int32)> GetElementPtr = [&MapHelper, &InternalIndices](int32 Index)
+	{ return MapHelper.GetPairPtr(InternalIndices[Index]); };
+	const FProperty* ElementProperties[] = {MapProperty->KeyProp, MapProperty->ValueProp};
+
 	TFunction<bool(int32, const FDrawingContext&)> DrawAtIndex =
-		[&MapHelper, &MapProperty](int32 Index, const FDrawingContext& NewContext)
+		[&GetElementPtr, &MapProperty](int32 Index, const FDrawingContext& NewContext)
 	{
-		uint8* PairData = MapHelper.FindNthPairPtr(Index);
+		uint8* PairData = static_cast<uint8*>(GetElementPtr(Index));
 		bool Modified	= false;
 		ImGui::NewLine();
 		ImGui::Indent();
@@ -178,8 +661,8 @@ bool SrgImGuiTypeDrawer_Private::DrawMapPropertyValue(void* ContainerPtr, int32
 	TFunction<void()> AddDefault		 = [&MapHelper]() { MapHelper.AddDefaultValue_Invalid_NeedsRehash(); };
 	TFunction<void(int32)> RemoveAtIndex = [&MapHelper](int32 Index) { MapHelper.RemoveAt(MapHelper.FindInternalIndex(Index)); };
 
-	const bool Modified = DrawContainerPropertyValue(HasInnerArray, CollapsingHeaderTitle, ContainerSize, DrawAtIndex, AddDefault,
-													 RemoveAtIndex, Context);
+	const bool Modified = DrawContainerPropertyValue(HasInnerArray, CollapsingHeaderTitle, ContainerSize, GetElementPtr,
+													 ElementProperties, DrawAtIndex, AddDefault, RemoveAtIndex, Context);
 
 	if (Modified)
 	{
@@ -0,0 +1,216 @@
+// © Surgent Studios
+
+#include "TypeDrawer/SrgImGuiTypeDrawer_DataTable.h"
+
+#include <imgui.h>
+
+#include "Engine/DataTable.h"
+
+#include "SrgImGuiMemory.h"
+#include "SrgImGuiStats.h"
+#include "TypeDrawer/SrgImGuiTypeDrawer.h"
+#include "TypeDrawer/SrgImGuiTypeDrawer_Table.h"
+
+namespace SrgImGuiTypeDrawer_Private
+{
+	static constexpr uint64 DATA_TABLE_CACHE_LIFETIME_FRAMES = 120;
+
+	struct FDataTableCache
+	{
+		uint64 LastUsedFrame = 0;
+
+		TWeakObjectPtr<UDataTable> DataTable;
+		FDelegateHandle OnChangedHandle;
+		// Set when the table broadcasts a change, which rows can be added, removed or renamed with.
+		bool Dirty = true;
+
+		// The names of the rows, in the order of the row map, and the same names converted to UTF-8 once. The memory of the
+		// visible rows is looked up by name when drawn, as the table can free it at any time (e.g. a reimport).
+		TArray<FName> Rows;
+		TArray<ANSICHAR> RowNames;
+		TArray<int32> RowNameOffsets;
+		FPropertyTablePlan Plan;
+
+		ImGuiTextFilter Filter;
+		// Indices in Rows of the rows whose name passes the filter.
+		TArray<int32> FilteredRows;
+		FPropertyTableSort Sort;
+
+		SIZE_T GetAllocatedSize() const
+		{
+			return Rows.GetAllocatedSize() + RowNames.GetAllocatedSize() + RowNameOffsets.GetAllocatedSize() +
+				   Plan.Columns.GetAllocatedSize() + FilteredRows.GetAllocatedSize() + Sort.Order.GetAllocatedSize() +
+				   Filter.Filters.size_in_bytes();
+		}
+
+		const ANSICHAR* GetRowName(int32 Row) const { return &RowNames[RowNameOffsets[Row]]; }
+	};
+
+	// Only accessed from the game thread. The caches are allocated separately so that the one being drawn stays valid when a
+	// row draws another data table (e.g. through an object property), which can add a cache and reallocate the map.
+	static TMap<ImGuiID, TUniquePtr<FDataTableCache>> DataTableCaches;
+	static uint64 LastDataTableEvictionFrame = 0;
+
+	static SrgImGuiMemory::FAutoRegisterGatherer DataTableCachesGatherer(
+		[](SrgImGuiMemory::FReport& Report)
+		{
+			SIZE_T Size = DataTableCaches.GetAllocatedSize();
+			for (const TPair<ImGuiID, TUniquePtr<FDataTableCache>>& Pair : DataTableCaches)
+			{
+				Size += Pair.Value->GetAllocatedSize();
+			}
+			Report.Add(SrgImGuiMemory::Category::ItemCaches, Size, DataTableCaches.Num());
+		});
+
+	void UnbindFromDataTable(FDataTableCache& Cache)
+	{
+		if (UDataTable* DataTable = Cache.DataTable.Get())
+		{
+			DataTable->OnDataTableChanged().Remove(Cache.OnChangedHandle);
+		}
+		Cache.OnChangedHandle.Reset();
+	}
+
+	FDataTableCache& FindOrAddDataTableCache(ImGuiID Id, UDataTable& DataTable)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+
+		if (LastDataTableEvictionFrame != GFrameCounter)
+		{
+			LastDataTableEvictionFrame = GFrameCounter;
+			for (auto It = DataTableCaches.CreateIterator(); It; ++It)
+			{
+				if (It->Value->LastUsedFrame + DATA_TABLE_CACHE_LIFETIME_FRAMES < GFrameCounter)
+				{
+					UnbindFromDataTable(*It->Value);
+					It.RemoveCurrent();
+				}
+			}
+		}
+
+		TUniquePtr<FDataTableCache>& CachePtr = DataTableCaches.FindOrAdd(Id);
+		if (!CachePtr)
+		{
+			CachePtr = MakeUnique<FDataTableCache>();
+		}
+		FDataTableCache& Cache = *CachePtr;
+		Cache.LastUsedFrame	   = GFrameCounter;
+		if (Cache.DataTable != &DataTable)
+		{
+			UnbindFromDataTable(Cache);
+			Cache.DataTable = &DataTable;
+			// The cache is looked up again as it may have been evicted since.
+			Cache.OnChangedHandle = DataTable.OnDataTableChanged().AddLambda(
+				[Id]()
+				{
+					if (TUniquePtr<FDataTableCache>* ChangedCache = DataTableCaches.Find(Id))
+					{
+						(*ChangedCache)->Dirty = true;
+					}
+				});
+			Cache.Dirty = true;
+		}
+		return Cache;
+	}
+
+	void FilterRows(FDataTableCache& Cache)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+
+		Cache.FilteredRows.Reset();
+		if (!Cache.Filter.IsActive())
+		{
+			Cache.FilteredRows.SetNumUninitialized(Cache.Rows.Num());
+			for (int32 Row = 0; Row < Cache.Rows.Num(); ++Row)
+			{
+				Cache.FilteredRows[Row] = Row;
+			}
+		}
+		else
+		{
+			for (int32 Row = 0; Row < Cache.Rows.Num(); ++Row)
+			{
+				if (Cache.Filter.PassFilter(Cache.GetRowName(Row)))
+				{
+					Cache.FilteredRows.Add(Row);
+				}
+			}
+		}
+		Cache.Sort.Invalidate();
+	}
+
+	void RefreshRows(FDataTableCache& Cache, const UDataTable& DataTable)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+
+		const TMap<FName, uint8*>& RowMap = DataTable.GetRowMap();
+		Cache.Rows.Reset(RowMap.Num());
+		Cache.RowNames.Reset();
+		Cache.RowNameOffsets.Reset(RowMap.Num());
+		TStringBuilder<NAME_SIZE> RowName;
+		for (const TPair<FName, uint8*>& Pair : RowMap)
+		{
+			Cache.Rows.Add(Pair.Key);
+
+			RowName.Reset();
+			Pair.Key.AppendString(RowName);
+			SrgImGuiStats::CountStringConversion();
+			const auto Utf8 = StringCast<UTF8CHAR>(RowName.ToString(), RowName.Len());
+			Cache.RowNameOffsets.Add(Cache.RowNames.Num());
+			Cache.RowNames.Append(reinterpret_cast<const ANSICHAR*>(Utf8.Get()), Utf8.Length());
+			Cache.RowNames.Add('\0');
+		}
+
+		const UScriptStruct* RowStruct = DataTable.GetRowStruct();
+		if (!RowStruct)
+		{
+			Cache.Plan = {};
+		}
+		else if (Cache.Plan.Struct != RowStruct)
+		{
+			Cache.Plan = FPropertyTablePlan::Compile(*RowStruct);
+		}
+
+		Cache.Dirty = false;
+		FilterRows(Cache);
+	}
+}	 // namespace SrgImGuiTypeDrawer_Private
+
+bool SrgImGuiTypeDrawer_Private::DrawDataTableRows(UDataTable& DataTable, const FDrawingContext& Context)
+{
+	if (!ImGui::CollapsingHeader("Rows", GetCollapsingHeaderFlags(Context)))
+	{
+		return false;
+	}
+
+	FDataTableCache& Cache = FindOrAddDataTableCache(ImGui::GetID("##DataTableRows"), DataTable);
+	// Rows can also be added or removed without a broadcast (e.g. from code).
+	if (Cache.Dirty || Cache.Rows.Num() != DataTable.GetRowMap().Num() || Cache.Plan.Struct != DataTable.GetRowStruct())
+	{
+		RefreshRows(Cache, DataTable);
+	}
+
+	ImGui::Indent();
+	if (Cache.Filter.Draw("Filter Rows", ImGui::GetFontSize() * 12.0f))
+	{
+		FilterRows(Cache);
+	}
+	ImGui::SameLine();
+	ImGui::TextDisabled("%d of %d rows", Cache.FilteredRows.Num(), Cache.Rows.Num());
+
+	bool Modified = false;
+	if (!Cache.Plan.Struct.IsValid())
+	{
+		ImGui::TextColored(ImVec4(1.f, 1.f, 0.f, 1.f), "%s", "The data table has no row struct.");
+	}
+	else
+	{
+		Modified = DrawPropertyTable(
+			"##Rows", Cache.Plan, Cache.FilteredRows.Num(),
+			[&Cache, &DataTable](int32 Row) -> void* { return DataTable.FindRowUnchecked(Cache.Rows[Cache.FilteredRows[Row]]); },
+			"Row Name",
+			[&Cache](int32 Row) { ImGui::TextUnformatted(Cache.GetRowName(Cache.FilteredRows[Row])); }, Cache.Sort, Context);
+	}
+	ImGui::Unindent();
+	return Modified;
+}
@@ -4,10 +4,15 @@
 
 #include <imgui.h>
 
+#include "Engine/DataTable.h"
+
 #include "SrgImGuiStringConversion.h"
+#include "SrgImGuiTrace.h"
 #include "Interfaces/SrgImGuiCustomDrawer.h"
 #include "Interfaces/SrgImGuiMutable.h"
 #include "TypeDrawer/SrgImGuiTypeDrawer.h"
+#include "TypeDrawer/SrgImGuiTypeDrawer_DataTable.h"
+#include "TypeDrawer/SrgImGuiTypeDrawer_Search.h"
 
 namespace SrgImGuiTypeDrawer_Private
 {
@@ -29,11 +34,18 @@ namespace SrgImGuiTypeDrawer_Private
 			NewContext.HasCollapsingHeader = true;
 			NewContext.Mutable			   = IsMutable;
 
+			const bool IsSearching = IsSearchingProperties(Class, NewContext);
+			if (!IsSearching)
+			{
+				NewContext.Search = nullptr;
+			}
+
+			// While searching, the parents are only drawn if one of their properties is on the path to a match.
 			UClass* Super = Class.GetSuperClass();
-			if (Super)
+			if (Super && (!IsSearching || HasSearchedProperties(*Super, /*IncludeSuper = */ true, NewContext)))
 			{
 				FString SuperText = FString::Printf(TEXT("Parent: (%s)"), *Super->GetName());
-				if (ImGui::CollapsingHeader(TO_IMGUI(*SuperText)))
+				if (ImGui::CollapsingHeader(TO_IMGUI(*SuperText), GetCollapsingHeaderFlags(NewContext)))
 				{
 					ImGui::Indent();
 					WasModified |= DrawObject_Internal(Object, *Super, NewContext);
@@ -44,9 +56,24 @@ namespace SrgImGuiTypeDrawer_Private
 			// Force Draw Default should be passed along to the parent but not to other properties.
 			NewContext.ForceDrawDefault = false;
 
-			for (TFieldIterator<FProperty> PropIt(&Class, EFieldIteratorFlags::ExcludeSuper); PropIt; ++PropIt)
+			if (IsSearching)
+			{
+				ForEachSearchedProperty(Class, /*IncludeSuper = */ false, NewContext,
+										[&Object, &WasModified](FProperty& Property, const FDrawingContext& PropertyContext)
+										{ WasModified |= DrawProperty(&Object, &Property, PropertyContext); });
+			}
+			else
 			{
-				WasModified |= DrawProperty(&Object, *PropIt, NewContext);
+				for (TFieldIterator<FProperty> PropIt(&Class, EFieldIteratorFlags::ExcludeSuper); PropIt; ++PropIt)
+				{
+					WasModified |= DrawProperty(&Object, *PropIt, NewContext);
+				}
+
+				// The rows of data tables are not properties, so they are drawn by a dedicated drawer.
+				if (&Class == UDataTable::StaticClass())
+				{
+					WasModified |= DrawDataTableRows(*CastChecked<UDataTable>(&Object), NewContext);
+				}
 			}
 		}
 		else
@@ -58,6 +85,14 @@ namespace SrgImGuiTypeDrawer_Private
 
 		return WasModified;
 	}
+
+	// Referenced objects can point back to the object being drawn, so their headers are never expanded by default.
+	FDrawingContext MakeReferencedObjectContext(const FDrawingContext& Context)
+	{
+		FDrawingContext NewContext(Context);
+		NewContext.ExpandHeaders = false;
+		return NewContext;
+	}
 }	 // namespace SrgImGuiTypeDrawer_Private
 
 bool SrgImGuiTypeDrawer_Private::DrawObjectValue(UObject* Object, UClass* Class, const FDrawingContext& Context)
@@ -75,7 +110,7 @@ bool SrgImGuiTypeDrawer_Private::DrawObjectValue(UObject* Object, UClass* Class,
 	if (Context.HasCollapsingHeader)
 	{
 		const FString Text = FString::Printf(TEXT("%s (%s)"), *Object->GetName(), *Class->GetName());
-		ShowInnerContent   = ImGui::CollapsingHeader(TO_IMGUI(*Text));
+		ShowInnerContent   = ImGui::CollapsingHeader(TO_IMGUI(*Text), GetCollapsingHeaderFlags(Context));
 	}
 
 	if (!ShowInnerContent)
@@ -83,11 +118,24 @@ bool SrgImGuiTypeDrawer_Private::DrawObjectValue(UObject* Object, UClass* Class,
 		return false;
 	}
 
+	SrgImGuiTrace::FScope TraceScope(*Class);
+
 	if (Context.HasCollapsingHeader)
 	{
 		ImGui::Indent();
 	}
-	const bool WasModified = DrawObject_Internal(*Object, *Class, Context);
+
+	// Objects with a custom drawer only have a search box if their properties are drawn.
+	FDrawingContext InnerContext(Context);
+	if (Context.HasSearch)
+	{
+		InnerContext.HasSearch = false;
+		if (Context.ForceDrawDefault || !Class->ImplementsInterface(USrgImGuiCustomDrawer::StaticClass()))
+		{
+			DrawPropertySearch(*Class, InnerContext);
+		}
+	}
+	const bool WasModified = DrawObject_Internal(*Object, *Class, InnerContext);
 	if (Context.HasCollapsingHeader)
 	{
 		ImGui::Unindent();
@@ -102,7 +150,7 @@ bool SrgImGuiTypeDrawer_Private::DrawObjectPropertyValue(void* ContainerPtr, int
 	FObjectProperty* ObjectProperty = CastField<FObjectProperty>(&Property);
 	UObject** ObjectData			= Property.ContainerPtrToValuePtr<UObject*>(ContainerPtr, ArrayIndex);
 	UClass* Class					= (*ObjectData) ? (*ObjectData)->GetClass() : ObjectProperty->PropertyClass.Get();
-	DrawObjectValue(*ObjectData, Class, Context);
+	DrawObjectValue(*ObjectData, Class, MakeReferencedObjectContext(Context));
 	// Here it needs to return false even if the object is modified because the property holds a pointer to the object and not the
 	// object itself. Since the pointer itself is not being modified, we always return false.
 	return false;
@@ -116,7 +164,7 @@ bool SrgImGuiTypeDrawer_Private::DrawWeakObjectPropertyValue(void* ContainerPtr,
 	FWeakObjectPtr WeakObject				= WeakObjectProperty->GetPropertyValue_InContainer(ContainerPtr, ArrayIndex);
 	UObject* Object							= WeakObject.Get();
 	UClass* Class							= Object ? Object->GetClass() : WeakObjectProperty->PropertyClass.Get();
-	DrawObjectValue(Object, Class, Context);
+	DrawObjectValue(Object, Class, MakeReferencedObjectContext(Context));
 	// Here it needs to return false even if the object is modified because the property holds a pointer to the object and not the
 	// object itself. Since the pointer itself is not being modified, we always return false.
 	return false;
@@ -135,10 +183,11 @@ bool SrgImGuiTypeDrawer_Private::DrawSoftObjectPropertyValue(void* ContainerPtr,
 	if (Object)
 	{
 		const FString Text = FString::Printf(TEXT("%s - LOADED (%s)"), *SoftObject.ToString(), *Class->GetName());
-		if (ImGui::CollapsingHeader(TO_IMGUI(*Text)))
+		const FDrawingContext ReferencedObjectContext = MakeReferencedObjectContext(Context);
+		if (ImGui::CollapsingHeader(TO_IMGUI(*Text), GetCollapsingHeaderFlags(ReferencedObjectContext)))
 		{
 			ImGui::Indent();
-			DrawObject_Internal(*Object, *Class, Context);
+			DrawObject_Internal(*Object, *Class, ReferencedObjectContext);
 			ImGui::Unindent();
 		}
 	}
@@ -174,7 +223,7 @@ bool SrgImGuiTypeDrawer_Private::DrawInterfacePropertyValue(void* ContainerPtr,
 	FScriptInterface ScriptInterface	  = InterfaceProperty->GetPropertyValue_InContainer(ContainerPtr, ArrayIndex);
 	UObject* Object						  = ScriptInterface.GetObject();
 	UClass* Class						  = Object ? Object->GetClass() : InterfaceProperty->InterfaceClass.Get();
-	DrawObjectValue(Object, Class, Context);
+	DrawObjectValue(Object, Class, MakeReferencedObjectContext(Context));
 	// Here it needs to return false even if the object is modified because the property holds a pointer to the object and not the
 	// object itself. Since the pointer itself is not being modified, we always return false.
 	return false;
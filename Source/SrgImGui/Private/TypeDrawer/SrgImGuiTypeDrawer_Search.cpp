@@ -0,0 +1,388 @@
+// © Surgent Studios
+
+#include "TypeDrawer/SrgImGuiTypeDrawer_Search.h"
+
+#include <imgui.h>
+
+#include "SrgImGuiMemory.h"
+#include "SrgImGuiStats.h"
+
+namespace SrgImGuiTypeDrawer_Private
+{
+	static constexpr int32 SEARCH_INDEX_MAX_DEPTH			= 8;
+	static constexpr int32 SEARCH_INDEX_MAX_REFERENCE_DEPTH = 2;
+	static constexpr int32 SEARCH_INDEX_MAX_ENTRIES			= 1 << 16;
+	static constexpr uint64 PROPERTY_SEARCH_LIFETIME_FRAMES = 120;
+
+	// Every property path that can be reached from a struct or class through its nested structs, the elements of its containers
+	// and the objects it references (by their declared class). Entries are in depth-first order, so the subtree of an entry is
+	// the range of entries that follows it.
+	struct FPropertySearchIndex
+	{
+		struct FEntry
+		{
+			FProperty* Property = nullptr;
+			// The struct or class the children of this entry are properties of, if it has any.
+			const UStruct* ChildStruct = nullptr;
+			int32 Parent			   = INDEX_NONE;
+			// One past the last entry of the subtree of this entry.
+			int32 SubtreeEnd = 0;
+			// Offset in Paths of the UTF-8 path of this entry (e.g. "Inventory.Items.Damage").
+			int32 PathOffset = 0;
+		};
+
+		// The index points at the properties of every struct it went through, so it is rebuilt if any of them is gone or had its
+		// properties replaced (e.g. a recompiled user defined struct).
+		bool IsUpToDate() const
+		{
+			for (const TPair<TWeakObjectPtr<const UStruct>, const FField*>& Pair : Dependencies)
+			{
+				const UStruct* Dependency = Pair.Key.Get();
+				if (!Dependency || Dependency->ChildProperties != Pair.Value)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		SIZE_T GetAllocatedSize() const
+		{
+			return Entries.GetAllocatedSize() + Paths.GetAllocatedSize() + Dependencies.GetAllocatedSize();
+		}
+
+		const ANSICHAR* GetPath(int32 Entry) const { return &Paths[Entries[Entry].PathOffset]; }
+
+		// The first child of an entry, or of the indexed struct itself for INDEX_NONE.
+		int32 GetFirstChild(int32 Entry) const { return Entry == INDEX_NONE ? 0 : Entry + 1; }
+		int32 GetChildrenEnd(int32 Entry) const { return Entry == INDEX_NONE ? Entries.Num() : Entries[Entry].SubtreeEnd; }
+		const UStruct* GetChildStruct(int32 Entry) const
+		{
+			return Entry == INDEX_NONE ? Struct.Get() : Entries[Entry].ChildStruct;
+		}
+
+		TWeakObjectPtr<const UStruct> Struct;
+		TArray<FEntry> Entries;
+		TArray<ANSICHAR> Paths;
+		TMap<TWeakObjectPtr<const UStruct>, const FField*> Dependencies;
+		// Set if the index reached SEARCH_INDEX_MAX_ENTRIES and some deeper paths are missing.
+		bool Truncated = false;
+	};
+
+	// The state of the search box of an inspector.
+	struct FPropertySearch
+	{
+		uint64 LastUsedFrame = 0;
+
+		TSharedPtr<const FPropertySearchIndex> Index;
+		ImGuiTextFilter Filter;
+		// The entries whose path passes the filter, without the ones below another match, and every entry on the path to them.
+		TBitArray<> Matched;
+		TBitArray<> Visible;
+		int32 NumMatches = 0;
+		// Set when the matches change, so the first match drawn is scrolled into view.
+		bool ScrollToMatch = false;
+
+		SIZE_T GetAllocatedSize() const
+		{
+			return Matched.GetAllocatedSize() + Visible.GetAllocatedSize() + Filter.Filters.size_in_bytes();
+		}
+	};
+
+	// Only accessed from the game thread. Searches are kept behind pointers as drawing contexts point at them while the map can
+	// grow (e.g. an inspector with a search drawn by a custom drawer inside another one).
+	static TMap<TWeakObjectPtr<const UStruct>, TSharedPtr<const FPropertySearchIndex>> SearchIndices;
+	static TMap<ImGuiID, TUniquePtr<FPropertySearch>> PropertySearches;
+	static uint64 LastPropertySearchEvictionFrame = 0;
+
+	static SrgImGuiMemory::FAutoRegisterGatherer PropertySearchGatherer(
+		[](SrgImGuiMemory::FReport& Report)
+		{
+			SIZE_T Size = SearchIndices.GetAllocatedSize() + PropertySearches.GetAllocatedSize();
+			for (const TPair<TWeakObjectPtr<const UStruct>, TSharedPtr<const FPropertySearchIndex>>& Pair : SearchIndices)
+			{
+				Size += sizeof(FPropertySearchIndex) + Pair.Value->GetAllocatedSize();
+			}
+			for (const TPair<ImGuiID, TUniquePtr<FPropertySearch>>& Pair : PropertySearches)
+			{
+				Size += sizeof(FPropertySearch) + Pair.Value->GetAllocatedSize();
+			}
+			Report.Add(SrgImGuiMemory::Category::ItemCaches, Size, SearchIndices.Num() + PropertySearches.Num());
+		});
+
+	// Returns the struct or class the values of the property are drawn with, if they are drawn with their own properties. Sets
+	// IsReference if the values are referenced objects.
+	const UStruct* GetSearchedStruct(const FProperty& Property, bool& IsReference)
+	{
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(&Property))
+		{
+			return GetSearchedStruct(*ArrayProperty->Inner, IsReference);
+		}
+		if (const FSetProperty* SetProperty = CastField<FSetProperty>(&Property))
+		{
+			return GetSearchedStruct(*SetProperty->ElementProp, IsReference);
+		}
+		// Only the values of maps are searched, as their keys are usually what identifies the pairs.
+		if (const FMapProperty* MapProperty = CastField<FMapProperty>(&Property))
+		{
+			return GetSearchedStruct(*MapProperty->ValueProp, IsReference);
+		}
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(&Property))
+		{
+			return StructProperty->Struct;
+		}
+		// Classes are drawn as a class picker rather than with their properties.
+		if (Property.IsA<FClassProperty>() || Property.IsA<FSoftClassProperty>())
+		{
+			return nullptr;
+		}
+		if (Property.IsA<FObjectProperty>() || Property.IsA<FWeakObjectProperty>() || Property.IsA<FSoftObjectProperty>())
+		{
+			IsReference = true;
+			return CastField<FObjectPropertyBase>(&Property)->PropertyClass;
+		}
+		return nullptr;
+	}
+
+	struct FSearchIndexBuilder
+	{
+		explicit FSearchIndexBuilder(FPropertySearchIndex& InIndex) : Index(InIndex) {}
+
+		void AddStruct(const UStruct& Struct, int32 Parent, int32 ReferenceDepth)
+		{
+			Index.Dependencies.Add(&Struct, Struct.ChildProperties);
+			Stack.Push(&Struct);
+
+			const int32 PathLength = Path.Len();
+			for (TFieldIterator<FProperty> PropIt(&Struct); PropIt; ++PropIt)
+			{
+				if (Index.Entries.Num() >= SEARCH_INDEX_MAX_ENTRIES)
+				{
+					Index.Truncated = true;
+					break;
+				}
+
+				if (PathLength > 0)
+				{
+					Path.AppendChar(TEXT('.'));
+				}
+				// User defined struct fields are named with a GUID suffix, so the name the user typed is searched instead.
+				Path.Append(PropIt->GetAuthoredName());
+
+				const int32 Entry				= Index.Entries.AddDefaulted();
+				Index.Entries[Entry].Property	= *PropIt;
+				Index.Entries[Entry].Parent		= Parent;
+				Index.Entries[Entry].PathOffset = Index.Paths.Num();
+
+				SrgImGuiStats::CountStringConversion();
+				const auto Utf8 = StringCast<UTF8CHAR>(Path.ToString(), Path.Len());
+				Index.Paths.Append(reinterpret_cast<const ANSICHAR*>(Utf8.Get()), Utf8.Length());
+				Index.Paths.Add('\0');
+
+				// Types that contain themselves (e.g. through an array or a reference) are only indexed once per path.
+				bool IsReference				= false;
+				const UStruct* ChildStruct		= GetSearchedStruct(**PropIt, IsReference);
+				const int32 ChildReferenceDepth = ReferenceDepth + (IsReference ? 1 : 0);
+				if (ChildStruct && Stack.Num() < SEARCH_INDEX_MAX_DEPTH &&
+					ChildReferenceDepth <= SEARCH_INDEX_MAX_REFERENCE_DEPTH && !Stack.Contains(ChildStruct))
+				{
+					Index.Entries[Entry].ChildStruct = ChildStruct;
+					AddStruct(*ChildStruct, Entry, ChildReferenceDepth);
+				}
+				Index.Entries[Entry].SubtreeEnd = Index.Entries.Num();
+
+				Path.RemoveSuffix(Path.Len() - PathLength);
+			}
+
+			Stack.Pop();
+		}
+
+		FPropertySearchIndex& Index;
+		// The structs on the current path.
+		TArray<const UStruct*, TInlineAllocator<SEARCH_INDEX_MAX_DEPTH>> Stack;
+		TStringBuilder<256> Path;
+	};
+
+	TSharedPtr<const FPropertySearchIndex> FindOrBuildSearchIndex(const UStruct& Struct)
+	{
+		if (const TSharedPtr<const FPropertySearchIndex>* Found = SearchIndices.Find(&Struct))
+		{
+			if ((*Found)->IsUpToDate())
+			{
+				return *Found;
+			}
+		}
+
+		SRG_IMGUI_LLM_SCOPE();
+
+		// The indices of types that were unloaded or reinstanced are dropped whenever a new one is built.
+		for (auto It = SearchIndices.CreateIterator(); It; ++It)
+		{
+			if (!It->Key.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		TSharedRef<FPropertySearchIndex> Index = MakeShared<FPropertySearchIndex>();
+		Index->Struct						   = &Struct;
+		FSearchIndexBuilder(*Index).AddStruct(Struct, INDEX_NONE, 0);
+		Index->Entries.Shrink();
+		Index->Paths.Shrink();
+
+		SearchIndices.Add(&Struct, Index);
+		return Index;
+	}
+
+	FPropertySearch& FindOrAddPropertySearch(ImGuiID Id)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+
+		if (LastPropertySearchEvictionFrame != GFrameCounter)
+		{
+			LastPropertySearchEvictionFrame = GFrameCounter;
+			for (auto It = PropertySearches.CreateIterator(); It; ++It)
+			{
+				if (It->Value->LastUsedFrame + PROPERTY_SEARCH_LIFETIME_FRAMES < GFrameCounter)
+				{
+					It.RemoveCurrent();
+				}
+			}
+		}
+
+		TUniquePtr<FPropertySearch>& Search = PropertySearches.FindOrAdd(Id);
+		if (!Search)
+		{
+			Search = MakeUnique<FPropertySearch>();
+		}
+		Search->LastUsedFrame = GFrameCounter;
+		return *Search;
+	}
+
+	void MatchPropertySearch(FPropertySearch& Search)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+
+		const FPropertySearchIndex& Index = *Search.Index;
+		const int32 NumEntries			  = Index.Entries.Num();
+		Search.Matched.Init(false, NumEntries);
+		Search.Visible.Init(false, NumEntries);
+		Search.NumMatches = 0;
+
+		for (int32 Entry = 0; Entry < NumEntries;)
+		{
+			if (!Search.Filter.PassFilter(Index.GetPath(Entry)))
+			{
+				++Entry;
+				continue;
+			}
+
+			Search.Matched[Entry] = true;
+			++Search.NumMatches;
+			// The entries on the path to a match are shared with other matches, so the walk stops at the first one already set.
+			for (int32 Path = Entry; Path != INDEX_NONE && !Search.Visible[Path]; Path = Index.Entries[Path].Parent)
+			{
+				Search.Visible[Path] = true;
+			}
+			// Everything below a match is drawn with it, so the paths below it are not matched.
+			Entry = Index.Entries[Entry].SubtreeEnd;
+		}
+
+		Search.ScrollToMatch = Search.NumMatches > 0;
+	}
+
+	bool IsSearchedOwner(const UStruct& Struct, bool IncludeSuper, const FProperty& Property)
+	{
+		const UStruct* Owner = Property.GetOwnerStruct();
+		return IncludeSuper ? Struct.IsChildOf(Owner) : Owner == &Struct;
+	}
+}	 // namespace SrgImGuiTypeDrawer_Private
+
+void SrgImGuiTypeDrawer_Private::DrawPropertySearch(const UStruct& Struct, FDrawingContext& Context)
+{
+	FPropertySearch& Search = FindOrAddPropertySearch(ImGui::GetID("##PropertySearch"));
+
+	bool Changed = Search.Filter.Draw("Search Properties", ImGui::GetFontSize() * 12.0f);
+	if (!Search.Filter.IsActive())
+	{
+		return;
+	}
+
+	// The index is only built once something is searched, and then shared by every inspector of the type.
+	if (!Search.Index || Search.Index->Struct != &Struct || !Search.Index->IsUpToDate())
+	{
+		Search.Index = FindOrBuildSearchIndex(Struct);
+		Changed		 = true;
+	}
+	if (Changed)
+	{
+		MatchPropertySearch(Search);
+	}
+
+	ImGui::SameLine();
+	ImGui::TextDisabled("%d matches%s", Search.NumMatches, Search.Index->Truncated ? " (deep paths not indexed)" : "");
+
+	Context.Search		= &Search;
+	Context.SearchEntry = INDEX_NONE;
+}
+
+bool SrgImGuiTypeDrawer_Private::IsSearchingProperties(const UStruct& Struct, const FDrawingContext& Context)
+{
+	if (!Context.Search)
+	{
+		return false;
+	}
+
+	// The drawn struct can be a child of the searched one (e.g. the class of a referenced object) or one of its super structs
+	// (e.g. the parents of an object).
+	const UStruct* ChildStruct = Context.Search->Index->GetChildStruct(Context.SearchEntry);
+	return ChildStruct && (Struct.IsChildOf(ChildStruct) || ChildStruct->IsChildOf(&Struct));
+}
+
+bool SrgImGuiTypeDrawer_Private::HasSearchedProperties(const UStruct& Struct, bool IncludeSuper, const FDrawingContext& Context)
+{
+	check(Context.Search);
+	const FPropertySearch& Search	  = *Context.Search;
+	const FPropertySearchIndex& Index = *Search.Index;
+
+	const int32 End = Index.GetChildrenEnd(Context.SearchEntry);
+	for (int32 Entry = Index.GetFirstChild(Context.SearchEntry); Entry < End; Entry = Index.Entries[Entry].SubtreeEnd)
+	{
+		if (Search.Visible[Entry] && IsSearchedOwner(Struct, IncludeSuper, *Index.Entries[Entry].Property))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void SrgImGuiTypeDrawer_Private::ForEachSearchedProperty(const UStruct& Struct, bool IncludeSuper,
+														 const FDrawingContext& Context,
+														 TFunctionRef<void(FProperty&, const FDrawingContext&)> Visit)
+{
+	check(Context.Search);
+	FPropertySearch& Search			  = *Context.Search;
+	const FPropertySearchIndex& Index = *Search.Index;
+
+	FDrawingContext PropertyContext(Context);
+	const int32 End = Index.GetChildrenEnd(Context.SearchEntry);
+	for (int32 Entry = Index.GetFirstChild(Context.SearchEntry); Entry < End; Entry = Index.Entries[Entry].SubtreeEnd)
+	{
+		FProperty& Property = *Index.Entries[Entry].Property;
+		if (!Search.Visible[Entry] || !IsSearchedOwner(Struct, IncludeSuper, Property))
+		{
+			continue;
+		}
+
+		// Matches are drawn whole, while the properties that lead to them keep searching their own properties.
+		const bool IsMatch			= Search.Matched[Entry];
+		PropertyContext.Search		= IsMatch ? nullptr : &Search;
+		PropertyContext.SearchEntry = Entry;
+		if (IsMatch && Search.ScrollToMatch)
+		{
+			ImGui::SetScrollHereY(0.25f);
+			Search.ScrollToMatch = false;
+		}
+		Visit(Property, PropertyContext);
+	}
+}
@@ -4,18 +4,272 @@
 
 #include <imgui.h>
 
+#include "Algo/BinarySearch.h"
+#include "Hash/xxhash.h"
+
+#include "SrgImGuiMemory.h"
+#include "SrgImGuiStats.h"
 #include "SrgImGuiStringConversion.h"
 
+namespace SrgImGuiTypeDrawer_Private
+{
+	// 4096 characters should to be enough for a long paragraph.
+	static constexpr int32 TEXT_BUFFER_SIZE = 4096;
+
+	// Shared by every mutable string instead of placing the buffer on the stack for each string drawn.
+	// Only used from the game thread and only for the duration of a single input widget.
+	static TArray<ANSICHAR> TextEditBuffer;
+
+	static SrgImGuiMemory::FAutoRegisterGatherer TextEditBufferGatherer(
+		[](SrgImGuiMemory::FReport& Report)
+		{
+			const int32 NumBuffers = TextEditBuffer.IsEmpty() ? 0 : 1;
+			Report.Add(SrgImGuiMemory::Category::EditBuffers, TextEditBuffer.GetAllocatedSize(), NumBuffers);
+		});
+
+	// Strings that do not fit in the edit buffer are shown in a read-only viewer that only draws the visible lines.
+	// Longer lines are split so that drawing a line never lays out much more text than fits on screen.
+	static constexpr int32 LARGE_TEXT_MAX_LINE_BYTES		 = 512;
+	static constexpr int32 LARGE_TEXT_VISIBLE_LINES			 = 20;
+	static constexpr int32 LARGE_TEXT_SEARCH_BUFFER_SIZE	 = 128;
+	static constexpr uint64 LARGE_TEXT_CACHE_LIFETIME_FRAMES = 120;
+
+	struct FLargeTextCache
+	{
+		uint64 LastUsedFrame = 0;
+
+		// Identifies the string the cache was built from.
+		int32 Length = INDEX_NONE;
+		uint64 Hash	 = 0;
+
+		// The string as a null terminated UTF-8 string.
+		TArray<ANSICHAR> Utf8;
+		// The offset of the first byte of each drawn line.
+		TArray<int32> LineStarts;
+		int32 NumLines = 0;
+
+		ANSICHAR Search[LARGE_TEXT_SEARCH_BUFFER_SIZE] = {};
+		// The drawn lines that contain the search, in order.
+		TArray<int32> Matches;
+		int32 CurrentMatch	 = INDEX_NONE;
+		bool ScrollToCurrent = false;
+
+		SIZE_T GetAllocatedSize() const
+		{
+			return sizeof(FLargeTextCache) + Utf8.GetAllocatedSize() + LineStarts.GetAllocatedSize() + Matches.GetAllocatedSize();
+		}
+
+		// Returns the end of the line, without its line break.
+		const ANSICHAR* GetLineEnd(int32 Line) const
+		{
+			const int32 End		  = Line + 1 < LineStarts.Num() ? LineStarts[Line + 1] : Utf8.Num() - 1;
+			const ANSICHAR* Start = Utf8.GetData() + LineStarts[Line];
+			const ANSICHAR* It	  = Utf8.GetData() + End;
+			while (It > Start && (It[-1] == '\n' || It[-1] == '\r'))
+			{
+				--It;
+			}
+			return It;
+		}
+	};
+
+	// Only accessed from the game thread.
+	static TMap<ImGuiID, FLargeTextCache> LargeTextCaches;
+	static uint64 LastLargeTextEvictionFrame = 0;
+
+	static SrgImGuiMemory::FAutoRegisterGatherer LargeTextCachesGatherer(
+		[](SrgImGuiMemory::FReport& Report)
+		{
+			SIZE_T Size = LargeTextCaches.GetAllocatedSize();
+			for (const TPair<ImGuiID, FLargeTextCache>& Pair : LargeTextCaches)
+			{
+				Size += Pair.Value.GetAllocatedSize();
+			}
+			Report.Add(SrgImGuiMemory::Category::StringCaches, Size, LargeTextCaches.Num());
+		});
+
+	void BuildLineIndex(FLargeTextCache& Cache, const FString& Value)
+	{
+		SrgImGuiStats::CountStringConversion();
+		const FTCHARToUTF8 Converted(*Value, Value.Len());
+		const int32 NumBytes = Converted.Length();
+		Cache.Utf8.Reset(NumBytes + 1);
+		Cache.Utf8.Append(reinterpret_cast<const ANSICHAR*>(Converted.Get()), NumBytes);
+		Cache.Utf8.Add('\0');
+
+		Cache.LineStarts.Reset();
+		Cache.LineStarts.Add(0);
+		Cache.NumLines		   = 1;
+		const ANSICHAR* Text   = Cache.Utf8.GetData();
+		int32 CurrentLineStart = 0;
+		for (int32 Index = 0; Index < NumBytes; ++Index)
+		{
+			const int32 Next = Index + 1;
+			if (Text[Index] == '\n')
+			{
+				++Cache.NumLines;
+			}
+			// Long lines are split between two characters, never inside a multi-byte character.
+			else if (Next - CurrentLineStart < LARGE_TEXT_MAX_LINE_BYTES || Next == NumBytes || (Text[Next] & 0xC0) == 0x80)
+			{
+				continue;
+			}
+			CurrentLineStart = Next;
+			Cache.LineStarts.Add(Next);
+		}
+	}
+
+	void UpdateMatches(FLargeTextCache& Cache)
+	{
+		Cache.Matches.Reset();
+		if (Cache.Search[0] != '\0')
+		{
+			const ANSICHAR* Text = Cache.Utf8.GetData();
+			for (const ANSICHAR* Found = FCStringAnsi::Stristr(Text, Cache.Search); Found;)
+			{
+				const int32 Line = Algo::UpperBound(Cache.LineStarts, static_cast<int32>(Found - Text)) - 1;
+				Cache.Matches.Add(Line);
+				// A line is only listed once, however many times it contains the search.
+				if (Line + 1 >= Cache.LineStarts.Num())
+				{
+					break;
+				}
+				Found = FCStringAnsi::Stristr(Text + Cache.LineStarts[Line + 1], Cache.Search);
+			}
+		}
+		Cache.CurrentMatch	  = Cache.Matches.IsEmpty() ? INDEX_NONE : 0;
+		Cache.ScrollToCurrent = !Cache.Matches.IsEmpty();
+	}
+
+	FLargeTextCache& FindOrAddLargeTextCache(ImGuiID Id, const FString& Value)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+
+		if (LastLargeTextEvictionFrame != GFrameCounter)
+		{
+			LastLargeTextEvictionFrame = GFrameCounter;
+			for (auto It = LargeTextCaches.CreateIterator(); It; ++It)
+			{
+				if (It->Value.LastUsedFrame + LARGE_TEXT_CACHE_LIFETIME_FRAMES < GFrameCounter)
+				{
+					It.RemoveCurrent();
+				}
+			}
+		}
+
+		FLargeTextCache& Cache = LargeTextCaches.FindOrAdd(Id);
+		Cache.LastUsedFrame	   = GFrameCounter;
+
+		// Hashing is much cheaper than converting and indexing the string, which is only done when the string changes.
+		const uint64 Hash = FXxHash64::HashBuffer(*Value, Value.Len() * sizeof(TCHAR)).Hash;
+		if (Cache.Length != Value.Len() || Cache.Hash != Hash)
+		{
+			Cache.Length = Value.Len();
+			Cache.Hash	 = Hash;
+			BuildLineIndex(Cache, Value);
+			UpdateMatches(Cache);
+		}
+		return Cache;
+	}
+
+	void DrawLargeStringValue(const FString& Value)
+	{
+		FLargeTextCache& Cache = FindOrAddLargeTextCache(ImGui::GetID("##LargeText"), Value);
+
+		ImGui::BeginGroup();
+		ImGui::TextDisabled("%d lines, %d characters", Cache.NumLines, Value.Len());
+		ImGui::SameLine();
+		ImGui::SetNextItemWidth(ImGui::GetFontSize() * 12.0f);
+		if (ImGui::InputTextWithHint("##Search", "Search", Cache.Search, LARGE_TEXT_SEARCH_BUFFER_SIZE))
+		{
+			UpdateMatches(Cache);
+		}
+		if (!Cache.Matches.IsEmpty())
+		{
+			ImGui::SameLine();
+			if (ImGui::SmallButton("<"))
+			{
+				Cache.CurrentMatch	  = (Cache.CurrentMatch + Cache.Matches.Num() - 1) % Cache.Matches.Num();
+				Cache.ScrollToCurrent = true;
+			}
+			ImGui::SameLine();
+			if (ImGui::SmallButton(">"))
+			{
+				Cache.CurrentMatch	  = (Cache.CurrentMatch + 1) % Cache.Matches.Num();
+				Cache.ScrollToCurrent = true;
+			}
+			ImGui::SameLine();
+			ImGui::Text("%d/%d", Cache.CurrentMatch + 1, Cache.Matches.Num());
+		}
+		else if (Cache.Search[0] != '\0')
+		{
+			ImGui::SameLine();
+			ImGui::TextDisabled("No match");
+		}
+
+		const float LineHeight	= ImGui::GetTextLineHeightWithSpacing();
+		const int32 NumDrawn	= Cache.LineStarts.Num();
+		const float ChildHeight = LineHeight * FMath::Min(NumDrawn, LARGE_TEXT_VISIBLE_LINES) + ImGui::GetStyle().ScrollbarSize;
+		if (ImGui::BeginChild("##Lines", ImVec2(0.0f, ChildHeight), true, ImGuiWindowFlags_HorizontalScrollbar))
+		{
+			const int32 CurrentLine = Cache.CurrentMatch != INDEX_NONE ? Cache.Matches[Cache.CurrentMatch] : INDEX_NONE;
+			if (Cache.ScrollToCurrent)
+			{
+				ImGui::SetScrollY(FMath::Max(0.0f, CurrentLine * LineHeight - ImGui::GetWindowHeight() * 0.5f));
+				Cache.ScrollToCurrent = false;
+			}
+
+			const ImVec4 MatchColor(1.0f, 1.0f, 0.4f, 1.0f);
+			const ImVec4 CurrentMatchColor(1.0f, 0.6f, 0.2f, 1.0f);
+			ImGuiListClipper Clipper;
+			Clipper.Begin(NumDrawn, LineHeight);
+			while (Clipper.Step())
+			{
+				for (int32 Line = Clipper.DisplayStart; Line < Clipper.DisplayEnd; ++Line)
+				{
+					const bool IsMatch = Line == CurrentLine || Algo::BinarySearch(Cache.Matches, Line) != INDEX_NONE;
+					if (IsMatch)
+					{
+						ImGui::PushStyleColor(ImGuiCol_Text, Line == CurrentLine ? CurrentMatchColor : MatchColor);
+					}
+					ImGui::TextUnformatted(Cache.Utf8.GetData() + Cache.LineStarts[Line], Cache.GetLineEnd(Line));
+					if (IsMatch)
+					{
+						ImGui::PopStyleColor();
+					}
+				}
+			}
+		}
+		ImGui::EndChild();
+		ImGui::EndGroup();
+	}
+}	 // namespace SrgImGuiTypeDrawer_Private
+
 bool SrgImGuiTypeDrawer_Private::DrawStringValue(FString& Value, const FDrawingContext& Context)
 {
+	// The edit buffer holds UTF-8 and a null terminator, so a string of fewer characters than the buffer can still not fit.
+	// UTF-8 is never shorter than the characters, so only the strings that could fit are measured.
+	if (Value.Len() >= TEXT_BUFFER_SIZE || FPlatformString::ConvertedLength<UTF8CHAR>(*Value, Value.Len()) > TEXT_BUFFER_SIZE - 1)
+	{
+		// Editing would truncate the string to the size of the edit buffer, so it can only be cleared.
+		if (Context.Mutable && ImGui::Button("Clear"))
+		{
+			Value.Empty();
+			return true;
+		}
+		DrawLargeStringValue(Value);
+		return false;
+	}
+
 	bool Modified = false;
 	if (Context.Mutable)
 	{
-		// 4096 characters should to be enough for a long paragraph.
-		static constexpr uint32 TEXT_BUFFER_SIZE = 4096;
-
-		ANSICHAR TextBuffer[TEXT_BUFFER_SIZE];
-		ANSICHAR* TextBufferPtr = &TextBuffer[0];
+		if (TextEditBuffer.Num() != TEXT_BUFFER_SIZE)
+		{
+			SRG_IMGUI_LLM_SCOPE();
+			TextEditBuffer.SetNumUninitialized(TEXT_BUFFER_SIZE);
+		}
+		ANSICHAR* TextBufferPtr = TextEditBuffer.GetData();
 
 		FPlatformString::Strcpy(TextBufferPtr, TEXT_BUFFER_SIZE, TO_IMGUI(*Value));
 
@@ -5,7 +5,9 @@
 #include <imgui.h>
 
 #include "SrgImGuiStringConversion.h"
+#include "SrgImGuiTrace.h"
 #include "TypeDrawer/SrgImGuiTypeDrawer.h"
+#include "TypeDrawer/SrgImGuiTypeDrawer_Search.h"
 
 namespace SrgImGuiTypeDrawer_Private
 {
@@ -18,9 +20,19 @@ namespace SrgImGuiTypeDrawer_Private
 		NewContext.HasCollapsingHeader = true;
 
 		bool WasModified = false;
-		for (TFieldIterator<FProperty> PropIt(&Struct); PropIt; ++PropIt)
+		if (IsSearchingProperties(Struct, NewContext))
 		{
-			WasModified |= DrawProperty(StructData, *PropIt, NewContext);
+			ForEachSearchedProperty(Struct, /*IncludeSuper = */ true, NewContext,
+									[StructData, &WasModified](FProperty& Property, const FDrawingContext& PropertyContext)
+									{ WasModified |= DrawProperty(StructData, &Property, PropertyContext); });
+		}
+		else
+		{
+			NewContext.Search = nullptr;
+			for (TFieldIterator<FProperty> PropIt(&Struct); PropIt; ++PropIt)
+			{
+				WasModified |= DrawProperty(StructData, *PropIt, NewContext);
+			}
 		}
 
 		ImGui::PopID();
@@ -37,7 +49,7 @@ bool SrgImGuiTypeDrawer_Private::DrawStructValue(void* StructData, UScriptStruct
 	if (Context.HasCollapsingHeader)
 	{
 		const FString Text = FString::Printf(TEXT("(%s)"), *Struct->GetName());
-		ShowInnerContent   = ImGui::CollapsingHeader(TO_IMGUI(*Text));
+		ShowInnerContent   = ImGui::CollapsingHeader(TO_IMGUI(*Text), GetCollapsingHeaderFlags(Context));
 	}
 
 	if (!ShowInnerContent)
@@ -45,11 +57,20 @@ bool SrgImGuiTypeDrawer_Private::DrawStructValue(void* StructData, UScriptStruct
 		return false;
 	}
 
+	SrgImGuiTrace::FScope TraceScope(*Struct);
+
 	if (Context.HasCollapsingHeader)
 	{
 		ImGui::Indent();
 	}
-	const bool WasModified = DrawStructValue_Internal(StructData, *Struct, Context);
+
+	FDrawingContext InnerContext(Context);
+	if (Context.HasSearch)
+	{
+		InnerContext.HasSearch = false;
+		DrawPropertySearch(*Struct, InnerContext);
+	}
+	const bool WasModified = DrawStructValue_Internal(StructData, *Struct, InnerContext);
 	if (Context.HasCollapsingHeader)
 	{
 		ImGui::Unindent();
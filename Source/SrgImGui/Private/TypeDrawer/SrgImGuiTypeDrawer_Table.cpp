@@ -0,0 +1,308 @@
+// © Surgent Studios
+
+#include "TypeDrawer/SrgImGuiTypeDrawer_Table.h"
+
+#include <imgui.h>
+
+#include "Algo/Reverse.h"
+#include "Algo/StableSort.h"
+
+#include "SrgImGuiMemory.h"
+#include "SrgImGuiStats.h"
+#include "SrgImGuiStringConversion.h"
+#include "TypeDrawer/SrgImGuiTypeDrawer.h"
+
+namespace SrgImGuiTypeDrawer_Private
+{
+	static constexpr int32 TABLE_VISIBLE_ROWS			= 20;
+	static constexpr uint64 TABLE_STATE_LIFETIME_FRAMES = 120;
+
+	void SortRows(const FPropertyTablePlan& Plan, int32 NumRows, TFunctionRef<void*(int32)> GetRow, FPropertyTableSort& Sort)
+	{
+		SRG_IMGUI_LLM_SCOPE();
+
+		Sort.Order.SetNumUninitialized(NumRows);
+		for (int32 Row = 0; Row < NumRows; ++Row)
+		{
+			Sort.Order[Row] = Row;
+		}
+
+		if (Plan.Columns.IsValidIndex(Sort.Column))
+		{
+			// The keys are read once per row instead of once per comparison.
+			const FProperty& Property = *Plan.Columns[Sort.Column].Property;
+			TArray<FSortKey> Keys;
+			Keys.SetNum(NumRows);
+			for (int32 Row = 0; Row < NumRows; ++Row)
+			{
+				if (const void* RowPtr = GetRow(Row))
+				{
+					GetSortKey(Property, Property.ContainerPtrToValuePtr<void>(RowPtr), Keys[Row]);
+				}
+			}
+			Algo::StableSort(Sort.Order, [&Keys](int32 A, int32 B) { return Keys[A] < Keys[B]; });
+		}
+
+		if (Sort.Descending)
+		{
+			Algo::Reverse(Sort.Order);
+		}
+		Sort.Valid = true;
+	}
+
+	struct FStructPlan
+	{
+		// Shared with the tables drawing it, so that a recompile while they draw does not free it under them.
+		TSharedPtr<const FPropertyTablePlan> Plan;
+		// User defined structs are relinked in place when they are recompiled, which replaces their properties.
+		const FField* ChildProperties = nullptr;
+	};
+
+	struct FStructArrayState
+	{
+		uint64 LastUsedFrame = 0;
+		FPropertyTableSort Sort;
+		// The span the order was sorted for.
+		const void* Base = nullptr;
+		int32 Stride	 = 0;
+	};
+
+	// Only accessed from the game thread. The states are allocated separately so that the one being drawn stays valid when a
+	// cell draws another struct array (e.g. through a custom drawer), which can add a state and reallocate the map.
+	static TMap<TWeakObjectPtr<const UScriptStruct>, FStructPlan> StructPlans;
+	static TMap<ImGuiID, TUniquePtr<FStructArrayState>> StructArrayStates;
+	static uint64 LastStructArrayEvictionFrame = 0;
+
+	static SrgImGuiMemory::FAutoRegisterGatherer StructArrayGatherer(
+		[](SrgImGuiMemory::FReport& Report)
+		{
+			SIZE_T Size = StructPlans.GetAllocatedSize() + StructArrayStates.GetAllocatedSize();
+			for (const TPair<TWeakObjectPtr<const UScriptStruct>, FStructPlan>& Pair : StructPlans)
+			{
+				Size += Pair.Value.Plan ? Pair.Value.Plan->Columns.GetAllocatedSize() : 0;
+			}
+			for (const TPair<ImGuiID, TUniquePtr<FStructArrayState>>& Pair : StructArrayStates)
+			{
+				Size += Pair.Value->Sort.Order.GetAllocatedSize();
+			}
+			Report.Add(SrgImGuiMemory::Category::ItemCaches, Size, StructPlans.Num() + StructArrayStates.Num());
+		});
+
+	TSharedRef<const FPropertyTablePlan> FindOrCompileStructPlan(const UScriptStruct& Struct)
+	{
+		FStructPlan& StructPlan = StructPlans.FindOrAdd(&Struct);
+		if (!StructPlan.Plan || !StructPlan.Plan->Struct.IsValid() || StructPlan.ChildProperties != Struct.ChildProperties)
+		{
+			StructPlan.Plan			   = MakeShared<const FPropertyTablePlan>(FPropertyTablePlan::Compile(Struct));
+			StructPlan.ChildProperties = Struct.ChildProperties;
+		}
+		return StructPlan.Plan.ToSharedRef();
+	}
+
+	FStructArrayState& FindOrAddStructArrayState(ImGuiID Id)
+	{
+		if (LastStructArrayEvictionFrame != GFrameCounter)
+		{
+			LastStructArrayEvictionFrame = GFrameCounter;
+			for (auto It = StructArrayStates.CreateIterator(); It; ++It)
+			{
+				if (It->Value->LastUsedFrame + TABLE_STATE_LIFETIME_FRAMES < GFrameCounter)
+				{
+					It.RemoveCurrent();
+				}
+			}
+		}
+
+		TUniquePtr<FStructArrayState>& State = StructArrayStates.FindOrAdd(Id);
+		if (!State)
+		{
+			State = MakeUnique<FStructArrayState>();
+		}
+		State->LastUsedFrame = GFrameCounter;
+		return *State;
+	}
+}	 // namespace SrgImGuiTypeDrawer_Private
+
+void SrgImGuiTypeDrawer_Private::GetSortKey(const FProperty& Property, const void* ValuePtr, FSortKey& OutKey)
+{
+	OutKey = {};
+	if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(&Property))
+	{
+		OutKey.Number	= NumericProperty->IsFloatingPoint()
+							  ? NumericProperty->GetFloatingPointPropertyValue(ValuePtr)
+							  : static_cast<double>(NumericProperty->GetSignedIntPropertyValue(ValuePtr));
+		OutKey.IsNumber = true;
+	}
+	else if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(&Property))
+	{
+		OutKey.Number	= static_cast<double>(EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr));
+		OutKey.IsNumber = true;
+	}
+	else if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(&Property))
+	{
+		OutKey.Number	= BoolProperty->GetPropertyValue(ValuePtr) ? 1.0 : 0.0;
+		OutKey.IsNumber = true;
+	}
+	else if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(&Property))
+	{
+		const UObject* Object = ObjectProperty->GetObjectPropertyValue(ValuePtr);
+		OutKey.Text			  = Object ? Object->GetName() : FString();
+	}
+	else if (const FStrProperty* StrProperty = CastField<FStrProperty>(&Property))
+	{
+		OutKey.Text = StrProperty->GetPropertyValue(ValuePtr);
+	}
+	else
+	{
+		Property.ExportTextItem_Direct(OutKey.Text, ValuePtr, nullptr, nullptr, PPF_None);
+	}
+}
+
+SrgImGuiTypeDrawer_Private::FPropertyTablePlan SrgImGuiTypeDrawer_Private::FPropertyTablePlan::Compile(
+	const UStruct& Struct, TConstArrayView<FName> PropertyNames)
+{
+	SRG_IMGUI_LLM_SCOPE();
+
+	FPropertyTablePlan Plan;
+	Plan.Struct = &Struct;
+
+	auto AddColumn = [&Plan](FProperty* Property)
+	{
+		const FDrawPropertyValueFunction* DrawValue = Property ? FindDrawPropertyValueFunction(*Property) : nullptr;
+		if (DrawValue && Property->ArrayDim == 1)
+		{
+			Plan.Columns.Add({Property, DrawValue, FSrgImGuiLabel(Property->GetAuthoredName())});
+		}
+	};
+
+	if (PropertyNames.IsEmpty())
+	{
+		for (TFieldIterator<FProperty> PropIt(&Struct); PropIt; ++PropIt)
+		{
+			AddColumn(*PropIt);
+		}
+	}
+	else
+	{
+		for (const FName& PropertyName : PropertyNames)
+		{
+			AddColumn(Struct.FindPropertyByName(PropertyName));
+		}
+	}
+	return Plan;
+}
+
+bool SrgImGuiTypeDrawer_Private::DrawPropertyTable(const ANSICHAR* Id, const FPropertyTablePlan& Plan, int32 NumRows,
+												   TFunctionRef<void*(int32)> GetRow, const ANSICHAR* HeaderLabel,
+												   TFunctionRef<void(int32)> DrawRowHeader, FPropertyTableSort& Sort,
+												   const FDrawingContext& Context)
+{
+	constexpr ImGuiTableFlags TableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_Resizable |
+										   ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY;
+	const float Height = ImGui::GetFrameHeightWithSpacing() * (FMath::Min(NumRows, TABLE_VISIBLE_ROWS) + 1.5f);
+	if (!ImGui::BeginTable(Id, Plan.Columns.Num() + 1, TableFlags, ImVec2(0.0f, Height)))
+	{
+		return false;
+	}
+
+	ImGui::TableSetupScrollFreeze(1, 1);
+	ImGui::TableSetupColumn(HeaderLabel, ImGuiTableColumnFlags_DefaultSort);
+	for (const FPropertyTablePlan::FColumn& Column : Plan.Columns)
+	{
+		ImGui::TableSetupColumn(Column.Label.GetUtf8());
+	}
+	ImGui::TableHeadersRow();
+
+	ImGuiTableSortSpecs* SortSpecs = ImGui::TableGetSortSpecs();
+	if (SortSpecs && SortSpecs->SpecsDirty)
+	{
+		if (SortSpecs->SpecsCount > 0)
+		{
+			// The first column is the row header, which keeps the order of the rows.
+			Sort.Column		= SortSpecs->Specs[0].ColumnIndex - 1;
+			Sort.Descending = SortSpecs->Specs[0].SortDirection == ImGuiSortDirection_Descending;
+		}
+		SortSpecs->SpecsDirty = false;
+		Sort.Invalidate();
+	}
+	if (!Sort.Valid || Sort.Order.Num() != NumRows)
+	{
+		SortRows(Plan, NumRows, GetRow, Sort);
+	}
+
+	FDrawingContext CellContext(Context);
+	CellContext.HasCollapsingHeader = true;
+
+	bool Modified = false;
+	ImGuiListClipper Clipper;
+	Clipper.Begin(NumRows);
+	while (Clipper.Step())
+	{
+		for (int32 RowIndex = Clipper.DisplayStart; RowIndex < Clipper.DisplayEnd; ++RowIndex)
+		{
+			const int32 Row = Sort.Order[RowIndex];
+			void* RowPtr	= GetRow(Row);
+			ImGui::PushID(Row);
+
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			DrawRowHeader(Row);
+
+			for (int32 ColumnIndex = 0; ColumnIndex < Plan.Columns.Num(); ++ColumnIndex)
+			{
+				ImGui::TableNextColumn();
+				if (!RowPtr)
+				{
+					continue;
+				}
+
+				const FPropertyTablePlan::FColumn& Column = Plan.Columns[ColumnIndex];
+				SrgImGuiStats::CountPropertyDrawn();
+				ImGui::PushID(ColumnIndex);
+				ImGui::SetNextItemWidth(-FLT_MIN);
+				Modified |= (*Column.DrawValue)(RowPtr, 0, *Column.Property, CellContext);
+				ImGui::PopID();
+			}
+
+			ImGui::PopID();
+		}
+	}
+
+	ImGui::EndTable();
+	return Modified;
+}
+
+bool SrgImGuiTypeDrawer_Private::DrawStructArrayValue(void* Base, int32 Count, int32 Stride, UScriptStruct& Struct,
+													  const FDrawingContext& Context)
+{
+	check(Base || Count == 0);
+	check(Stride >= Struct.GetStructureSize());
+	SRG_IMGUI_LLM_SCOPE();
+
+	bool ShowInnerContent = true;
+	if (Context.HasCollapsingHeader)
+	{
+		char Title[256];
+		FCStringAnsi::Snprintf(Title, sizeof(Title), "(%s) (Num: %d)###StructArray", TO_IMGUI(*Struct.GetName()), Count);
+		ShowInnerContent = ImGui::CollapsingHeader(Title, GetCollapsingHeaderFlags(Context));
+	}
+
+	if (!ShowInnerContent)
+	{
+		return false;
+	}
+
+	const TSharedRef<const FPropertyTablePlan> Plan = FindOrCompileStructPlan(Struct);
+	FStructArrayState& State						= FindOrAddStructArrayState(ImGui::GetID("##StructArray"));
+	if (State.Base != Base || State.Stride != Stride)
+	{
+		State.Base	 = Base;
+		State.Stride = Stride;
+		State.Sort.Invalidate();
+	}
+
+	uint8* const Bytes = static_cast<uint8*>(Base);
+	return DrawPropertyTable(
+		"##StructArray", *Plan, Count, [Bytes, Stride](int32 Row) -> void* { return Bytes + static_cast<SIZE_T>(Row) * Stride; },
+		"#", [](int32 Row) { ImGui::Text("%d", Row); }, State.Sort, Context);
+}
@@ -4,9 +4,12 @@
 
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "Library/SrgImGuiLabel.h"
 
 #include "SrgImGuiCoreLibrary.generated.h"
 
+class USrgImGuiTimeSeries;
+
 UENUM(meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
 enum class ESrgImGuiWindowFlags : uint32
 {
@@ -81,6 +84,108 @@ enum class ESrgImGuiWindowFlags : uint32
 	UnsavedDocument = 1 << 20,
 };
 
+UENUM(meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class ESrgImGuiTableFlags : uint32
+{
+	None = 0 UMETA(Hidden),
+
+	// Enable resizing columns
+	Resizable = 1 << 0,
+
+	// Enable reordering columns in the header row
+	Reorderable = 1 << 1,
+
+	// Enable hiding/disabling columns in the context menu
+	Hideable = 1 << 2,
+
+	// Enable sorting. Call "Get Table Sort Specs" to obtain the sort specs
+	Sortable = 1 << 3,
+
+	// Disable persisting columns order, width and sort settings in the .ini file
+	NoSavedSettings = 1 << 4,
+
+	// Right-click on columns body/contents will display the table context menu. By default it is available in the header row
+	ContextMenuInBody = 1 << 5,
+
+	// Use alternating colors for the background of the rows
+	RowBg = 1 << 6,
+
+	// Draw horizontal borders between rows
+	BordersInnerH = 1 << 7,
+
+	// Draw horizontal borders at the top and bottom
+	BordersOuterH = 1 << 8,
+
+	// Draw vertical borders between columns
+	BordersInnerV = 1 << 9,
+
+	// Draw vertical borders on the left and right sides
+	BordersOuterV = 1 << 10,
+
+	// Enable horizontal scrolling. Requires an outer size. Use with "Setup Table Scroll Freeze" to keep columns visible
+	ScrollX = 1 << 24,
+
+	// Enable vertical scrolling. Requires an outer size. Use with "Setup Table Scroll Freeze" to keep the headers visible
+	ScrollY = 1 << 25,
+
+	// Hold shift when clicking headers to sort on multiple columns
+	SortMulti = 1 << 26,
+
+	// Allow no sorting, disable default sorting
+	SortTristate = 1 << 27,
+};
+
+UENUM(meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class ESrgImGuiTableColumnFlags : uint32
+{
+	None = 0 UMETA(Hidden),
+
+	// Default as a hidden/disabled column
+	DefaultHide = 1 << 0,
+
+	// Default as a sorting column
+	DefaultSort = 1 << 1,
+
+	// Column will stretch. Preferable with horizontal scrolling disabled
+	WidthStretch = 1 << 2,
+
+	// Column will not stretch. Preferable with horizontal scrolling enabled
+	WidthFixed = 1 << 3,
+
+	// Disable manual resizing
+	NoResize = 1 << 4,
+
+	// Disable manual reordering this column
+	NoReorder = 1 << 5,
+
+	// Disable ability to hide/disable this column
+	NoHide = 1 << 6,
+
+	// Disable ability to sort on this field
+	NoSort = 1 << 7,
+
+	// Make the initial sort direction ascending when first sorting on this column
+	PreferSortAscending = 1 << 8,
+
+	// Make the initial sort direction descending when first sorting on this column
+	PreferSortDescending = 1 << 9,
+};
+
+// A column the table is sorted on, as returned by "ImGui - Get Table Sort Specs".
+USTRUCT(BlueprintType)
+struct SRGIMGUI_API FSrgImGuiTableSortSpec
+{
+	GENERATED_BODY()
+
+public:
+	// The index of the column, in the order the columns were set up.
+	UPROPERTY(BlueprintReadOnly, Category = "SRG ImGui")
+	int32 ColumnIndex = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "SRG ImGui")
+	bool Ascending = true;
+};
+
 /**
  * This static class provides blueprint access to core ImGui function.
  */
@@ -454,6 +559,30 @@ public:
 			  meta = (DisplayName = "ImGui - List Box", ReturnDisplayName = "Selection Changed?"))
 	static bool List(const FString& Label, const TArray<FString>& Items, UPARAM(ref) int32& SelectedItemIndex);
 
+	/**
+	 * Draws a combo box for large sets of items, with a filter and type-ahead.
+	 * The items are only converted to UTF-8 when they change, and only the visible ones are drawn.
+	 * @param Label The label to use for the selection of the combo box.
+	 * @param Items The display text of each selectable items.
+	 * @param SelectedItemIndex The index within the Items array of the item currently selected.
+	 * @return Returns true if the selected item index changed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Widgets",
+			  meta = (DisplayName = "ImGui - Combo Box (Filtered)", ReturnDisplayName = "Selection Changed?"))
+	static bool FilteredCombo(const FString& Label, const TArray<FString>& Items, UPARAM(ref) int32& SelectedItemIndex);
+
+	/**
+	 * Draws a list box for large sets of items, with a filter and type-ahead.
+	 * The items are only converted to UTF-8 when they change, and only the visible ones are drawn.
+	 * @param Label The label to use for the selection of the list box.
+	 * @param Items The display text of each selectable items.
+	 * @param SelectedItemIndex The index within the Items array of the item currently selected.
+	 * @return Returns true if the selected item index changed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Widgets",
+			  meta = (DisplayName = "ImGui - List Box (Filtered)", ReturnDisplayName = "Selection Changed?"))
+	static bool FilteredList(const FString& Label, const TArray<FString>& Items, UPARAM(ref) int32& SelectedItemIndex);
+
 	/**
 	 * Draws an editable color.
 	 * @param Label The label for this widget.
@@ -544,9 +673,22 @@ public:
 	 * @return Returns true if the value was modified.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Widgets|Plots", meta = (DisplayName = "ImGui - Plot Lines (Clamped)"))
-	static void PlotLinesClamped(const FString& Label, const TArray<float> Data, const FString& OverlayText, FVector2D Size,
+	static void PlotLinesClamped(const FString& Label, const TArray<float>& Data, const FString& OverlayText, FVector2D Size,
 								 float Min = 0.f, float Max = 1.f);
 
+	/**
+	 * Draws a plot as lines, decimated to the min and max of the samples under each pixel.
+	 * Stays cheap with hundreds of thousands of samples, and never hides spikes. Zoom with the mouse wheel, pan by dragging
+	 * and reset the view by double clicking.
+	 * @param Label The label for this widget.
+	 * @param Data The data points to plot.
+	 * @param OverlayText Optional text to show on top of the plot.
+	 * @param Size The size of the plot widget. (0,0) means it will use the default size.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Widgets|Plots",
+			  meta = (DisplayName = "ImGui - Plot Lines (Decimated)"))
+	static void PlotLinesDecimated(const FString& Label, const TArray<float>& Data, const FString& OverlayText, FVector2D Size);
+
 	///**
 	// * Draws a plot as an histogram.
 	// * @param Label The label for this widget.
@@ -569,9 +711,24 @@ public:
 	// */
 	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Widgets|Plots",
 			  meta = (DisplayName = "ImGui - Plot Histogram (Clamped)"))
-	static void PlotHistogramClamped(const FString& Label, const TArray<float> Data, const FString& OverlayText, FVector2D Size,
+	static void PlotHistogramClamped(const FString& Label, const TArray<float>& Data, const FString& OverlayText, FVector2D Size,
 									 float Min = 0.f, float Max = 1.f);
 
+	/**
+	 * Draws one or more time series as lines on the same plot. The samples are read from the series directly, without copies.
+	 * Hovering the plot shows the value of every series under the cursor.
+	 * @param Label The label for this widget.
+	 * @param Series The time series to draw, created with "ImGui - Create Time Series".
+	 * @param OverlayText Optional text to show on top of the plot.
+	 * @param Size The size of the plot widget. (0,0) means it will use the default size.
+	 * @param FitToSamples If true, the plot is scaled to the samples and Min and Max are ignored.
+	 * @param Min The minimum value of the plot. Must be lower or equal to Max.
+	 * @param Max The maximum value of the plot. Must be higher or equal to Min.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Widgets|Plots", meta = (DisplayName = "ImGui - Plot Time Series"))
+	static void PlotTimeSeries(const FString& Label, const TArray<USrgImGuiTimeSeries*>& Series, const FString& OverlayText,
+							   FVector2D Size, bool FitToSamples = true, float Min = 0.f, float Max = 1.f);
+
 	/*
 	 * Draws a separator, generally horizontal.
 	 * Inside a menu bar or in horizontal layout mode, this becomes a vertical separator.
@@ -653,4 +810,206 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Layout|Columns", meta = (DisplayName = "ImGui - Next Column"))
 	static void NextColumn();
+
+	/**
+	 * Begins a table. Tables replace columns: they support borders, scrolling, resizing, reordering and sorting.
+	 * Call "Setup Table Column" for each column and "Table Headers Row" to draw the headers. Then, for each row, call
+	 * "Table Next Row" followed by "Table Next Column" before the widgets of each cell.
+	 * Note: Always call "End Table" if, and only if, the table was created (returns true).
+	 * @param Id The ID of the table. See "Push ID" for more info.
+	 * @param Columns The number of columns of the table.
+	 * @param Flags Options to control how the table is displayed.
+	 * @param OuterSize The size of the table. Needed by scrolling tables. (0,0) means it will use the available width.
+	 * @return Returns true if the table was created and is visible.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Layout|Tables",
+			  meta = (DisplayName = "ImGui - Begin Table", ReturnDisplayName = "Created?"))
+	static bool BeginTable(const FString& Id, UPARAM(meta = (ClampMin = 1)) int32 Columns,
+						   UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/SrgImGui.ESrgImGuiTableFlags")) int32 Flags,
+						   FVector2D OuterSize);
+
+	/*
+	 * Ends the current table.
+	 * Note: Only call this if "Begin Table" was called before and returned true (Table was successfully created).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Layout|Tables", meta = (DisplayName = "ImGui - End Table"))
+	static void EndTable();
+
+	/**
+	 * Sets up the next column of the current table.
+	 * Note: Only call this right after "Begin Table", once per column.
+	 * @param Label The label shown in the header of the column.
+	 * @param Flags Options to control how the column is displayed and sorted.
+	 * @param Width The width of a fixed column or the weight of a stretched column. 0 means automatic.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Layout|Tables",
+			  meta = (DisplayName = "ImGui - Setup Table Column"))
+	static void SetupTableColumn(const FString& Label,
+								 UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/SrgImGui.ESrgImGuiTableColumnFlags")) int32 Flags,
+								 float Width = 0.f);
+
+	/**
+	 * Keeps the first columns and rows visible while scrolling the table.
+	 * Note: Only call this after "Begin Table", before the first row.
+	 * @param Columns The number of columns to keep visible when scrolling horizontally.
+	 * @param Rows The number of rows to keep visible when scrolling vertically. 1 keeps the headers visible.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Layout|Tables",
+			  meta = (DisplayName = "ImGui - Setup Table Scroll Freeze"))
+	static void SetupTableScrollFreeze(int32 Columns = 0, int32 Rows = 1);
+
+	/*
+	 * Draws a row with the labels of the columns. Clicking them sorts sortable tables, right-clicking them opens the table
+	 * context menu.
+	 * Note: Only call this after the columns were set up.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Layout|Tables", meta = (DisplayName = "ImGui - Table Headers Row"))
+	static void TableHeadersRow();
+
+	/**
+	 * Begins a new row in the current table.
+	 * @param MinHeight The minimum height of the row.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Layout|Tables", meta = (DisplayName = "ImGui - Table Next Row"))
+	static void TableNextRow(float MinHeight = 0.f);
+
+	/**
+	 * Moves to the next column of the current row, or to the first column of the next row after the last one.
+	 * @return Returns false if the column is not visible. Its widgets can then be skipped.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Layout|Tables",
+			  meta = (DisplayName = "ImGui - Table Next Column", ReturnDisplayName = "Visible?"))
+	static bool TableNextColumn();
+
+	/**
+	 * Moves to a column of the current row.
+	 * @param ColumnIndex The index of the column.
+	 * @return Returns false if the column is not visible. Its widgets can then be skipped.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Layout|Tables",
+			  meta = (DisplayName = "ImGui - Table Set Column Index", ReturnDisplayName = "Visible?"))
+	static bool TableSetColumnIndex(int32 ColumnIndex);
+
+	/**
+	 * Gets the columns a sortable table is sorted on, from the primary to the last one.
+	 * The items only need to be sorted again when this returns true, so cache the sorted order and sort it only then.
+	 * Note: Only call this after the columns were set up.
+	 * @param SortSpecs The columns the table is sorted on.
+	 * @return Returns true the first time it is called and every time the sorting changed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Layout|Tables",
+			  meta = (DisplayName = "ImGui - Get Table Sort Specs", ReturnDisplayName = "Sorting Changed?"))
+	static bool GetTableSortSpecs(TArray<FSrgImGuiTableSortSpec>& SortSpecs);
+
+	/**
+	 * Begins clipping a long list of items of the same height, so that only the visible items are drawn.
+	 * Call "Clipper Step" in a loop until it returns false, and draw the items from Display Start to Display End (exclusive)
+	 * at each step. Works in windows, child windows and tables (one row per item).
+	 * Note: Always loop until "Clipper Step" returns false, or call "End Clipper" when exiting the loop early.
+	 * @param ItemCount The total number of items.
+	 * @param ItemHeight The height of each item, spacing included. -1 measures it from the first item.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Layout|Clipper", meta = (DisplayName = "ImGui - Begin Clipper"))
+	static void BeginClipper(int32 ItemCount, float ItemHeight = -1.f);
+
+	/**
+	 * Steps the current clipper. Ends it automatically when it returns false.
+	 * @param DisplayStart The index of the first item to draw.
+	 * @param DisplayEnd The index after the last item to draw.
+	 * @return Returns true if the items in the range must be drawn.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Layout|Clipper",
+			  meta = (DisplayName = "ImGui - Clipper Step", ReturnDisplayName = "Has Items?"))
+	static bool ClipperStep(int32& DisplayStart, int32& DisplayEnd);
+
+	/*
+	 * Ends the current clipper.
+	 * Note: Only call this when exiting the "Clipper Step" loop before it returned false.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Layout|Clipper", meta = (DisplayName = "ImGui - End Clipper"))
+	static void EndClipper();
+
+	/**
+	 * Makes a label that is converted to UTF-8 once, for the "(Label)" variants of the core functions.
+	 * Store the label in a variable instead of making it every frame, or nothing is saved.
+	 * @param Text The text of the label.
+	 */
+	UFUNCTION(BlueprintPure, Category = "SRG ImGui|Core|Labels", meta = (DisplayName = "ImGui - Make Label"))
+	static FSrgImGuiLabel MakeLabel(const FString& Text);
+
+	/*
+	 * Same as "Push ID" with a label. Pushes the hash stored in the label, without hashing its text.
+	 * Note: Always call "Pop ID" to remove this ID from the stack.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Stack", meta = (DisplayName = "ImGui - Push ID (Label)"))
+	static void PushIdLabel(const FSrgImGuiLabel& Id);
+
+	/*
+	 * Same as "Begin Window" with a label.
+	 * Note: Always call "End Window" to close the window even if the window is collapsed (false is returned).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Windows",
+			  meta = (DisplayName = "ImGui - Begin Window (Label)", ReturnDisplayName = "Expanded?"))
+	static bool BeginWindowLabel(const FSrgImGuiLabel& Title,
+								 UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/SrgImGui.ESrgImGuiWindowFlags")) int32 Flags);
+
+	/*
+	 * Same as "Begin Menu" with a label.
+	 * Note: Always call "End Menu" if, and only if, the menu was created (returns true).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Menu",
+			  meta = (DisplayName = "ImGui - Begin Menu (Label)", ReturnDisplayName = "Created?"))
+	static bool BeginMenuLabel(const FSrgImGuiLabel& Label, bool Enabled = true);
+
+	// Same as "Menu Item" with a label.
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Menu",
+			  meta = (DisplayName = "ImGui - Menu Item (Label)", ReturnDisplayName = "Activated?"))
+	static bool MenuItemLabel(const FSrgImGuiLabel& Label, bool Enabled = true);
+
+	// Same as "Collapsing Header" with a label.
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Containers",
+			  meta = (DisplayName = "ImGui - Collapsing Header (Label)", ReturnDisplayName = "Expanded?"))
+	static bool CollapsingHeaderLabel(const FSrgImGuiLabel& Label);
+
+	/*
+	 * Same as "Begin Tree Node" with a label.
+	 * Note: Always call "End Tree Node" if, and only if, the tree node is expanded (returns true).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Containers",
+			  meta = (DisplayName = "ImGui - Begin Tree Node (Label)", ReturnDisplayName = "Expanded?"))
+	static bool BeginTreeNodeLabel(const FSrgImGuiLabel& Label);
+
+	/*
+	 * Same as "Begin Tab" with a label.
+	 * Note: Always call "End Tab" if, and only if, the tab is selected (returns true).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Containers|Tabs",
+			  meta = (DisplayName = "ImGui - Begin Tab (Label)", ReturnDisplayName = "Selected?"))
+	static bool BeginTabLabel(const FSrgImGuiLabel& Label);
+
+	// Same as "Text Colored" with a label.
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Widgets", meta = (DisplayName = "ImGui - Text Colored (Label)"))
+	static void TextColoredLabel(const FSrgImGuiLabel& Label, FLinearColor Color = FLinearColor::White);
+
+	// Same as "Button" with a label.
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Widgets",
+			  meta = (DisplayName = "ImGui - Button (Label)", ReturnDisplayName = "Clicked?"))
+	static bool ButtonLabel(const FSrgImGuiLabel& Label);
+
+	// Same as "Small Button" with a label.
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Widgets",
+			  meta = (DisplayName = "ImGui - Small Button (Label)", ReturnDisplayName = "Clicked?"))
+	static bool SmallButtonLabel(const FSrgImGuiLabel& Label);
+
+	// Same as "Combo Box" with labels for the combo box and its items.
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Widgets",
+			  meta = (DisplayName = "ImGui - Combo Box (Label)", ReturnDisplayName = "Selection Changed?"))
+	static bool ComboLabel(const FSrgImGuiLabel& Label, const TArray<FSrgImGuiLabel>& Items,
+						   UPARAM(ref) int32& SelectedItemIndex);
+
+	// Same as "List Box" with labels for the list box and its items.
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Core|Widgets",
+			  meta = (DisplayName = "ImGui - List Box (Label)", ReturnDisplayName = "Selection Changed?"))
+	static bool ListLabel(const FSrgImGuiLabel& Label, const TArray<FSrgImGuiLabel>& Items,
+						  UPARAM(ref) int32& SelectedItemIndex);
 };
\ No newline at end of file
@@ -0,0 +1,21 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Combo and list boxes for large sets of items.
+ * The items are converted to UTF-8 once and kept in a cache per widget, which is only rebuilt when the contents of the items
+ * change. A filter field narrows the items down (ImGui filter syntax: "inc,-exc"), only the visible items are drawn, and
+ * typing while the items are focused jumps to the first item starting with the typed text.
+ * Combo boxes only check their items while they are open.
+ */
+namespace SrgImGuiFilteredList
+{
+	// Returns true if the selected item index changed.
+	SRGIMGUI_API bool Combo(const TCHAR* Label, TConstArrayView<FString> Items, int32& SelectedItemIndex);
+
+	// Returns true if the selected item index changed.
+	SRGIMGUI_API bool List(const TCHAR* Label, TConstArrayView<FString> Items, int32& SelectedItemIndex);
+}	 // namespace SrgImGuiFilteredList
@@ -9,6 +9,11 @@
 
 class ISrgImGuiCustomDrawer;
 
+namespace SrgImGuiMemory
+{
+	class FReport;
+}
+
 /**
  * This static class provides functionality to draw information about the SRG ImGui plugin.
  */
@@ -87,6 +92,9 @@ public:
 
 	static FString GetChordKeysAsString(const TArray<FKey>& ChordKeys);
 
+	// Adds the memory held by the demos to a SrgImGui memory report.
+	static void GatherMemoryReport(SrgImGuiMemory::FReport& Report);
+
 private:
 	static bool OpenCustomDrawerDemo;
 	static bool OpenCoreDemo;
@@ -0,0 +1,57 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SrgImGuiLabel.generated.h"
+
+/**
+ * A label for the core ImGui functions that is converted to UTF-8 once instead of on every call.
+ * Build it once with "ImGui - Make Label" (e.g. in a variable or on construction) and pass it to the "(Label)" variants of
+ * the core functions. Panels with hundreds of constant labels then skip the string conversions of every frame.
+ */
+USTRUCT(BlueprintType, meta = (HasNativeMake = "/Script/SrgImGui.SrgImGuiCoreLibrary.MakeLabel"))
+struct SRGIMGUI_API FSrgImGuiLabel
+{
+	GENERATED_BODY()
+
+public:
+	FSrgImGuiLabel() = default;
+	explicit FSrgImGuiLabel(const FString& InText);
+
+	const FString& GetText() const { return Text; }
+
+	// The label as a null terminated UTF-8 string, as expected by ImGui.
+	const ANSICHAR* GetUtf8() const
+	{
+		EncodeIfNeeded();
+		return Utf8.GetData();
+	}
+
+	// Hash of the label. Pushed by "ImGui - Push ID (Label)" so that the text does not need to be hashed.
+	uint32 GetId() const
+	{
+		EncodeIfNeeded();
+		return Id;
+	}
+
+private:
+	// Labels that were not built from text (e.g. loaded or copied by the property system) are encoded on first use.
+	void EncodeIfNeeded() const
+	{
+		if (Utf8.IsEmpty())
+		{
+			Encode();
+		}
+	}
+
+	void Encode() const;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SRG ImGui", meta = (AllowPrivateAccess = "true"))
+	FString Text;
+
+	// Holds at least the null terminator once encoded.
+	mutable TArray<ANSICHAR> Utf8;
+	mutable uint32 Id = 0;
+};
@@ -0,0 +1,59 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SrgImGuiPropertyPath.generated.h"
+
+struct FSrgImGuiCompiledPropertyPath;
+
+// The value a property path leads to, in the form the type drawers take it.
+struct FSrgImGuiPropertyValue
+{
+	void* ContainerPtr	= nullptr;
+	FProperty* Property = nullptr;
+	int32 ArrayIndex	= 0;
+
+	bool IsValid() const { return ContainerPtr && Property; }
+};
+
+/**
+ * A path to a property of an object, such as "Inventory.Items[3].Stats.Damage", compiled into the offsets and properties that
+ * lead to its value. Members are separated by dots. Brackets index static arrays, arrays and sets, or look up a key of a map
+ * (e.g. "Resistances[Fire]").
+ * The path is compiled the first time it is resolved, and again only when the class of the object, or of an object on the way,
+ * changes, or when a struct on the way is recompiled. Nested struct members are folded into a single offset and the pair last
+ * found in a map is checked before hashing its key, so resolving the path every frame only follows its containers and
+ * objects. Build the path once (e.g. in a variable) so that it is not compiled every frame.
+ */
+USTRUCT(BlueprintType, meta = (HasNativeMake = "/Script/SrgImGui.SrgImGuiTypeLibrary.MakePropertyPath"))
+struct SRGIMGUI_API FSrgImGuiPropertyPath
+{
+	GENERATED_BODY()
+
+public:
+	FSrgImGuiPropertyPath() = default;
+	explicit FSrgImGuiPropertyPath(const FString& InPath);
+
+	// Returns the value of the path on the object, compiling the path if needed. The value is invalid if the path does not exist
+	// on the class of the object, or if an object, element or key on the way is missing. GetError() then tells why.
+	FSrgImGuiPropertyValue Resolve(UObject* Object) const;
+
+	const FString& GetPath() const { return Path; }
+	// Why the last resolve failed, or empty if it did not.
+	const FString& GetError() const;
+	// Includes the compiled path, which is shared by the copies of the path.
+	SIZE_T GetAllocatedSize() const;
+
+	// Returns the property of the struct with this name, also matching the names shown in the editor (e.g. the properties of
+	// user defined structs, whose names have a unique suffix).
+	static FProperty* FindPropertyByName(const UStruct& Struct, const FString& Name);
+
+private:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SRG ImGui", meta = (AllowPrivateAccess = "true"))
+	FString Path;
+
+	// Created on first use, so that paths loaded or copied by the property system are compiled too. Copies of a path share it.
+	mutable TSharedPtr<FSrgImGuiCompiledPropertyPath> Compiled;
+};
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 
+#include "Library/SrgImGuiPropertyPath.h"
 #include "TypeDrawer/SrgImGuiTypeDrawer.h"
 
 #include "SrgImGuiTypeLibrary.generated.h"
@@ -207,6 +208,25 @@ public:
 								  bool HasCollapsingHeader = true);
 	DECLARE_FUNCTION(execDrawStruct_K2Node);
 
+	/*
+	 * The following functions are what "ImGui - Struct", "ImGui - Class" and "ImGui - Soft Class" compile into once their
+	 * value pin is connected. The type is resolved when the Blueprint is compiled and passed as a literal, so at runtime the
+	 * thunks only read the address of the value and draw it, without casting or validating its property.
+	 */
+
+	UFUNCTION(BlueprintCallable, BlueprintInternalUseOnly, CustomThunk, meta = (CustomStructureParam = "Struct"))
+	static bool DrawStruct_Planned(const FString& Name, const int32& Struct, UScriptStruct* StructType, bool Mutable,
+								   bool HasCollapsingHeader);
+	DECLARE_FUNCTION(execDrawStruct_Planned);
+
+	UFUNCTION(BlueprintCallable, BlueprintInternalUseOnly, CustomThunk, meta = (CustomStructureParam = "Class"))
+	static bool DrawClass_Planned(const FString& Name, const int32& Class, UClass* MetaClass, bool Mutable);
+	DECLARE_FUNCTION(execDrawClass_Planned);
+
+	UFUNCTION(BlueprintCallable, BlueprintInternalUseOnly, CustomThunk, meta = (CustomStructureParam = "SoftClass"))
+	static bool DrawSoftClass_Planned(const FString& Name, const int32& SoftClass, UClass* MetaClass, bool Mutable);
+	DECLARE_FUNCTION(execDrawSoftClass_Planned);
+
 	template <typename StructType>
 	static bool DrawStruct(const FString& Name, StructType& Struct, bool Mutable = false, bool HasCollapsingHeader = true)
 	{
@@ -223,11 +243,12 @@ public:
 	 * @param Name The name of the object to draw.
 	 * @param Object The object to draw.
 	 * @param HasCollapsingHeader If true, the object will be wrapped in an ImGui collapsing header.
+	 * @param HasSearch If true, a search box will only show the properties whose path matches it.
 	 * @return Returns true if the value was modified.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Type|Container",
 			  meta = (DisplayName = "ImGui - Object", ReturnDisplayName = "Modified?"))
-	static bool DrawObject(const FString& Name, UObject* Object, bool HasCollapsingHeader = true);
+	static bool DrawObject(const FString& Name, UObject* Object, bool HasCollapsingHeader = true, bool HasSearch = false);
 
 	/**
 	 * Draws an array property using a default drawer.
@@ -282,6 +303,51 @@ public:
 	static bool DrawDefaultCustomDrawer(const FString& Name, TScriptInterface<ISrgImGuiCustomDrawer> CustomDrawer,
 										bool HasCollapsingHeader = true);
 
+	/**
+	 * Makes a property path, such as "Inventory.Items[3].Stats.Damage", for "ImGui - Watch".
+	 * Store the path in a variable instead of making it every frame, or it is compiled every frame.
+	 * @param Path The members to follow from the object, separated by dots. Brackets index arrays and sets or look up map keys.
+	 */
+	UFUNCTION(BlueprintPure, Category = "SRG ImGui|Type|Watch", meta = (DisplayName = "ImGui - Make Property Path"))
+	static FSrgImGuiPropertyPath MakePropertyPath(const FString& Path);
+
+	/**
+	 * Draws the value a property path leads to on an object using a default drawer.
+	 * @param Name The name of the value to draw.
+	 * @param Object The object the path starts from.
+	 * @param Path The path to the value. It is compiled for the class of the object on first use.
+	 * @param Mutable If true, the value will be editable.
+	 * @param HasCollapsingHeader If true, the value will be wrapped in an ImGui collapsing header.
+	 * @return Returns true if the value was modified.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Type|Watch",
+			  meta = (DisplayName = "ImGui - Watch", ReturnDisplayName = "Modified?"))
+	static bool DrawWatch(const FString& Name, UObject* Object, const FSrgImGuiPropertyPath& Path, bool Mutable = false,
+						  bool HasCollapsingHeader = true);
+
+	/**
+	 * Pins the value a property path leads to on an object to the watch panel, until it is unpinned or the object is destroyed.
+	 * @param Object The object the path starts from.
+	 * @param Path The path to the value, such as "Inventory.Items[3].Stats.Damage".
+	 * @param Mutable If true, the value will be editable in the watch panel.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Type|Watch", meta = (DisplayName = "ImGui - Pin Watch"))
+	static void PinWatch(UObject* Object, const FString& Path, bool Mutable = false);
+
+	/**
+	 * Removes a value pinned with "ImGui - Pin Watch" from the watch panel.
+	 * @param Object The object the path starts from.
+	 * @param Path The path the value was pinned with.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Type|Watch", meta = (DisplayName = "ImGui - Unpin Watch"))
+	static void UnpinWatch(UObject* Object, const FString& Path);
+
+	/**
+	 * Removes every value from the watch panel.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Type|Watch", meta = (DisplayName = "ImGui - Unpin All Watches"))
+	static void UnpinAllWatches();
+
 	template <typename StructType, typename PropertyType>
 	static bool DrawStructProperty(StructType& Struct, PropertyType& PropertyRef, bool Mutable = false,
 								   bool HasCollapsingHeader = true, int32 ArrayIndex = 0)
@@ -0,0 +1,36 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NativeGameplayTags.h"
+#include "Interfaces/SrgImGuiDrawTreeNode.h"
+#include "Templates/PimplPtr.h"
+
+#include "SrgImGuiLogPanel.generated.h"
+
+SRGIMGUI_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_SrgImGui_DrawTree_Log);
+
+namespace SrgImGuiLogPanel_Private
+{
+	struct FState;
+}	 // namespace SrgImGuiLogPanel_Private
+
+/**
+ * Built-in draw tree node that shows the lines captured by SrgImGuiLogCapture, filtered by category, verbosity and text.
+ * Only the visible lines are drawn. The lines that pass a filter are indexed once and the index is then only extended with
+ * the new lines, so filtering a large history does not scan it every frame.
+ * Registered by USrgImGuiSubsystem at "SrgImGui.DrawTree.Log" when enabled in the settings.
+ */
+UCLASS()
+class SRGIMGUI_API USrgImGuiLogPanel : public UObject, public ISrgImGuiDrawTreeNode
+{
+	GENERATED_BODY()
+
+public:
+	virtual ESrgImGuiDrawTreeNodeBehavior ImGui_DrawTreeNode_Start_Implementation(const FGameplayTag& NodeTag) override;
+	virtual void ImGui_DrawTreeNode_End_Implementation(const FGameplayTag& NodeTag) override;
+
+private:
+	TPimplPtr<SrgImGuiLogPanel_Private::FState> State;
+};
@@ -0,0 +1,25 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NativeGameplayTags.h"
+#include "Interfaces/SrgImGuiDrawTreeNode.h"
+
+#include "SrgImGuiMetricsPanel.generated.h"
+
+SRGIMGUI_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_SrgImGui_DrawTree_Metrics);
+
+/**
+ * Built-in draw tree node that shows every metric of the metrics registry (see FSrgImGuiMetric) with a sparkline of its recent
+ * history. Registered by USrgImGuiSubsystem at "SrgImGui.DrawTree.Metrics" when enabled in the settings.
+ */
+UCLASS()
+class SRGIMGUI_API USrgImGuiMetricsPanel : public UObject, public ISrgImGuiDrawTreeNode
+{
+	GENERATED_BODY()
+
+public:
+	virtual ESrgImGuiDrawTreeNodeBehavior ImGui_DrawTreeNode_Start_Implementation(const FGameplayTag& NodeTag) override;
+	virtual void ImGui_DrawTreeNode_End_Implementation(const FGameplayTag& NodeTag) override;
+};
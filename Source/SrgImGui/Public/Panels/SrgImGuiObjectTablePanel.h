@@ -0,0 +1,37 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NativeGameplayTags.h"
+#include "Interfaces/SrgImGuiDrawTreeNode.h"
+#include "Templates/PimplPtr.h"
+
+#include "SrgImGuiObjectTablePanel.generated.h"
+
+SRGIMGUI_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_SrgImGui_DrawTree_ObjectTable);
+
+namespace SrgImGuiObjectTablePanel_Private
+{
+	struct FState;
+}	 // namespace SrgImGuiObjectTablePanel_Private
+
+/**
+ * Built-in draw tree node that shows the live instances of a class as a table, with one row per instance and one column per
+ * picked property, so a value can be compared across thousands of objects.
+ * The columns are resolved once per class and property selection, only the visible rows are drawn, and the sorted row order
+ * is kept until the instances are gathered again. The instances are gathered a few classes per frame within a time budget.
+ * Registered by USrgImGuiSubsystem at "SrgImGui.DrawTree.ObjectTable" when enabled in the settings.
+ */
+UCLASS()
+class SRGIMGUI_API USrgImGuiObjectTablePanel : public UObject, public ISrgImGuiDrawTreeNode
+{
+	GENERATED_BODY()
+
+public:
+	virtual ESrgImGuiDrawTreeNodeBehavior ImGui_DrawTreeNode_Start_Implementation(const FGameplayTag& NodeTag) override;
+	virtual void ImGui_DrawTreeNode_End_Implementation(const FGameplayTag& NodeTag) override;
+
+private:
+	TPimplPtr<SrgImGuiObjectTablePanel_Private::FState> State;
+};
@@ -0,0 +1,161 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Interfaces/SrgImGuiDrawTreeNode.h"
+
+#include "SrgImGuiPanelAsset.generated.h"
+
+UENUM(BlueprintType)
+enum class ESrgImGuiPanelWidgetType : uint8
+{
+	// Label, optionally followed by the formatted value of the property.
+	Text,
+	// Label followed by the property drawn by the property inspector. Editable if mutable.
+	Property,
+	// Progress bar filled by the value of a numeric property between Min and Max.
+	ProgressBar,
+	// Calls a function without parameters on the target.
+	Button,
+	Separator,
+	// Places the next widget on the same line.
+	SameLine,
+	// Collapsing header. The following widgets until the matching End are only drawn when it is open.
+	BeginHeader,
+	// Tree node. The following widgets until the matching End are only drawn when it is open.
+	BeginTreeNode,
+	// Closes the last BeginHeader or BeginTreeNode.
+	End,
+};
+
+/**
+ * One widget of a panel asset. Widgets are listed in order and nested with BeginHeader/BeginTreeNode and End.
+ * Property paths are property names separated by dots, following struct and object properties (e.g. "Health.Current").
+ */
+USTRUCT(BlueprintType)
+struct SRGIMGUI_API FSrgImGuiPanelWidget
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SRG ImGui")
+	ESrgImGuiPanelWidgetType Type = ESrgImGuiPanelWidgetType::Text;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SRG ImGui")
+	FString Label;
+
+	// The property shown by Text, Property and ProgressBar widgets.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SRG ImGui")
+	FString PropertyPath;
+
+	// Replaces the label of Text and the overlay of ProgressBar widgets. "{0}" is replaced by the value of the property.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SRG ImGui")
+	FString Format;
+
+	// Number of decimals of floating point values in Text and ProgressBar widgets.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SRG ImGui", meta = (ClampMin = "0", ClampMax = "9"))
+	int32 Precision = 2;
+
+	// The widget (and its children) is only drawn if this bool, numeric or object property is true, non zero or valid.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SRG ImGui")
+	FString ConditionPath;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SRG ImGui")
+	bool InvertCondition = false;
+
+	// Color of the text of the widget. Transparent keeps the style color.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SRG ImGui")
+	FLinearColor Color = FLinearColor::Transparent;
+
+	// Whether Property widgets can edit the value.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SRG ImGui")
+	bool Mutable = false;
+
+	// The range of ProgressBar widgets.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SRG ImGui")
+	float Min = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SRG ImGui")
+	float Max = 1.0f;
+
+	// The function called by Button widgets.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SRG ImGui")
+	FName FunctionName;
+};
+
+struct FSrgImGuiPanelProgram;
+
+/**
+ * Describes a debug panel as a list of widgets bound to the properties of a target object.
+ * The description is compiled once into a native draw program: property paths are resolved to properties, labels are
+ * converted to UTF-8 and conditions know where their children end. Drawing it then needs no Blueprint VM call and no string
+ * conversion for constant text. Shown on the draw tree with USrgImGuiPanelAssetNode.
+ */
+UCLASS(BlueprintType)
+class SRGIMGUI_API USrgImGuiPanelAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// Shown as the collapsing header of the panel. The name of the asset if empty.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SRG ImGui")
+	FString Title;
+
+	// The class of the objects the panel is drawn for. Property paths are resolved against it.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SRG ImGui")
+	TSubclassOf<UObject> TargetClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SRG ImGui", meta = (TitleProperty = "{Type} {Label}"))
+	TArray<FSrgImGuiPanelWidget> Widgets;
+
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// Discards the compiled program. It is compiled again the next time the panel is drawn.
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Panels")
+	void Invalidate();
+
+	// Draws the widgets for Target, which must be of TargetClass. Returns true if a property was modified.
+	bool Draw(UObject* Target);
+
+	// The title as a null terminated UTF-8 string, as expected by ImGui.
+	const ANSICHAR* GetTitle();
+
+private:
+	const FSrgImGuiPanelProgram& GetProgram();
+
+	TSharedPtr<FSrgImGuiPanelProgram> Program;
+};
+
+/**
+ * Draw tree node that draws a panel asset for a target object inside a collapsing header.
+ * Create it with "ImGui - Create Panel Asset Node" and register it with USrgImGuiSubsystem::RegisterToDrawTree.
+ */
+UCLASS(BlueprintType)
+class SRGIMGUI_API USrgImGuiPanelAssetNode : public UObject, public ISrgImGuiDrawTreeNode
+{
+	GENERATED_BODY()
+
+public:
+	// The node is outered to the target so that it does not outlive it by much. Target can be null and set later.
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Panels", meta = (DisplayName = "ImGui - Create Panel Asset Node"))
+	static USrgImGuiPanelAssetNode* CreatePanelAssetNode(USrgImGuiPanelAsset* Panel, UObject* Target);
+
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Panels")
+	void SetTarget(UObject* NewTarget) { Target = NewTarget; }
+
+	UFUNCTION(BlueprintPure, Category = "SRG ImGui|Panels")
+	UObject* GetTarget() const { return Target.Get(); }
+
+	virtual ESrgImGuiDrawTreeNodeBehavior ImGui_DrawTreeNode_Start_Implementation(const FGameplayTag& NodeTag) override;
+	virtual void ImGui_DrawTreeNode_End_Implementation(const FGameplayTag& NodeTag) override;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SRG ImGui")
+	TObjectPtr<USrgImGuiPanelAsset> Panel;
+
+private:
+	TWeakObjectPtr<UObject> Target;
+};
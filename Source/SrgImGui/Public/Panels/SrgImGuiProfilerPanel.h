@@ -0,0 +1,42 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NativeGameplayTags.h"
+#include "Interfaces/SrgImGuiDrawTreeNode.h"
+
+#include "SrgImGuiProfilerPanel.generated.h"
+
+SRGIMGUI_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_SrgImGui_DrawTree_Profiler);
+
+namespace SrgImGuiProfiler
+{
+	struct FFrameCapture;
+	struct FThreadCapture;
+}	 // namespace SrgImGuiProfiler
+
+/**
+ * Built-in draw tree node that shows the scopes recorded with SRG_IMGUI_SCOPE as a call tree and a flame graph.
+ * Any of the last captured frames can be inspected, the capture can be frozen and the worst frame is kept aside.
+ * Registered by USrgImGuiSubsystem at "SrgImGui.DrawTree.Profiler" when enabled in the settings.
+ */
+UCLASS()
+class SRGIMGUI_API USrgImGuiProfilerPanel : public UObject, public ISrgImGuiDrawTreeNode
+{
+	GENERATED_BODY()
+
+public:
+	virtual ESrgImGuiDrawTreeNodeBehavior ImGui_DrawTreeNode_Start_Implementation(const FGameplayTag& NodeTag) override;
+	virtual void ImGui_DrawTreeNode_End_Implementation(const FGameplayTag& NodeTag) override;
+
+private:
+	void DrawControls();
+	const SrgImGuiProfiler::FFrameCapture* GetSelectedFrame() const;
+	void DrawCallTree(const SrgImGuiProfiler::FThreadCapture& Thread) const;
+	void DrawFlameGraph(const SrgImGuiProfiler::FFrameCapture& Frame, const SrgImGuiProfiler::FThreadCapture& Thread) const;
+
+	// 0 is the latest captured frame.
+	int32 SelectedFrameAge = 0;
+	bool ShowWorstFrame	   = false;
+};
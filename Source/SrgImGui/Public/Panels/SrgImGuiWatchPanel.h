@@ -0,0 +1,40 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NativeGameplayTags.h"
+#include "Interfaces/SrgImGuiDrawTreeNode.h"
+
+#include "SrgImGuiWatchPanel.generated.h"
+
+SRGIMGUI_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_SrgImGui_DrawTree_Watches);
+
+// Values pinned to the watch panel. Game thread only.
+// The watches are global to the process: every world (e.g. each PIE client) draws the same list, and unpinning removes a
+// watch for all of them. They are cleared when the module shuts down.
+namespace SrgImGuiWatches
+{
+	// Pins the value at Path (see FSrgImGuiPropertyPath) of the object to the watch panel, until it is unpinned or the object
+	// is destroyed. Pinning the same path of the same object again only updates Mutable.
+	SRGIMGUI_API void Pin(UObject* Object, const FString& Path, bool Mutable = false);
+	SRGIMGUI_API void Unpin(const UObject* Object, const FString& Path);
+	SRGIMGUI_API void UnpinAll();
+	SRGIMGUI_API int32 GetNumPinned();
+}	 // namespace SrgImGuiWatches
+
+/**
+ * Built-in draw tree node that shows the values pinned with SrgImGuiWatches, one row per value.
+ * Each path is compiled once for the class of its object, so drawing hundreds of deep values does not look any property up
+ * by name. While every row fits on a line, only the visible rows are resolved and drawn.
+ * Registered by USrgImGuiSubsystem at "SrgImGui.DrawTree.Watches" when enabled in the settings.
+ */
+UCLASS()
+class SRGIMGUI_API USrgImGuiWatchPanel : public UObject, public ISrgImGuiDrawTreeNode
+{
+	GENERATED_BODY()
+
+public:
+	virtual ESrgImGuiDrawTreeNodeBehavior ImGui_DrawTreeNode_Start_Implementation(const FGameplayTag& NodeTag) override;
+	virtual void ImGui_DrawTreeNode_End_Implementation(const FGameplayTag& NodeTag) override;
+};
@@ -0,0 +1,74 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+LLM_DECLARE_TAG_API(SrgImGui, SRGIMGUI_API);
+
+// Tags every allocation made in the current scope (including the ones made by ImGui) with the "SrgImGui" LLM tag.
+#define SRG_IMGUI_LLM_SCOPE() LLM_SCOPE_BYTAG(SrgImGui)
+
+namespace SrgImGuiMemory
+{
+	// Names of the categories reported by the plugin itself. Gatherers can also report their own categories.
+	namespace Category
+	{
+		inline const TCHAR* DrawTreeMaps	= TEXT("Draw Tree Maps");
+		inline const TCHAR* StringCaches	= TEXT("String Caches");
+		inline const TCHAR* EditBuffers		= TEXT("Edit Buffers");
+		inline const TCHAR* DemoObjects		= TEXT("Demo Objects");
+		inline const TCHAR* SubmissionQueue = TEXT("Submission Queue");
+		inline const TCHAR* Metrics			= TEXT("Metrics");
+		inline const TCHAR* Profiler		= TEXT("Profiler");
+		inline const TCHAR* PlotCaches		= TEXT("Plot Caches");
+		inline const TCHAR* ItemCaches		= TEXT("Item Caches");
+		inline const TCHAR* LogCapture		= TEXT("Log Capture");
+	}	 // namespace Category
+
+	struct FCategoryUsage
+	{
+		SIZE_T AllocatedBytes = 0;
+		int32 NumEntries	  = 0;
+	};
+
+	/**
+	 * Memory used by the plugin, grouped by category.
+	 * Reporting the same category more than once accumulates it (e.g. one entry per subsystem).
+	 */
+	class SRGIMGUI_API FReport
+	{
+	public:
+		void Add(const TCHAR* CategoryName, SIZE_T AllocatedBytes, int32 NumEntries = 0);
+
+		SIZE_T GetTotalAllocatedBytes() const;
+		const TMap<FString, FCategoryUsage>& GetCategories() const { return Categories; }
+
+		void Log(FOutputDevice& Ar) const;
+
+	private:
+		TMap<FString, FCategoryUsage> Categories;
+	};
+
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnGatherReport, FReport&);
+
+	// Broadcast when a memory report is requested. Anything that holds memory for the plugin should add itself to the report.
+	SRGIMGUI_API FOnGatherReport& OnGatherReport();
+
+	SRGIMGUI_API FReport GatherReport();
+
+	/**
+	 * Binds a gatherer to OnGatherReport for the lifetime of this object.
+	 * Meant to be declared as a static next to the memory it reports, the same way FAutoConsoleCommand is used.
+	 */
+	class SRGIMGUI_API FAutoRegisterGatherer : public FNoncopyable
+	{
+	public:
+		explicit FAutoRegisterGatherer(TFunction<void(FReport&)> Gatherer);
+		~FAutoRegisterGatherer();
+
+	private:
+		FDelegateHandle Handle;
+	};
+}	 // namespace SrgImGuiMemory
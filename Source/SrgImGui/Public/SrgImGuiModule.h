@@ -7,4 +7,6 @@
 
 class FSrgImGuiModule : public IModuleInterface
 {
+public:
+	virtual void ShutdownModule() override;
 };
@@ -68,6 +68,36 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = "Draw Tree", meta = (Categories = "SrgImGui.DrawTree", ShowOnlyInnerProperties))
 	TMap<FGameplayTag, FSrgImGuiGameplayTagArray> DrawTreeNodePriority;
 
+	// If enabled, the subsystem registers the built-in metrics panel at "SrgImGui.DrawTree.Metrics".
+	// The panel shows the metrics registered through FSrgImGuiMetric.
+	UPROPERTY(config, EditAnywhere, Category = "Built-in Panels")
+	bool MetricsPanel = true;
+
+	// If enabled, the subsystem registers the built-in profiler panel at "SrgImGui.DrawTree.Profiler".
+	// The panel shows the scopes recorded through SRG_IMGUI_SCOPE.
+	UPROPERTY(config, EditAnywhere, Category = "Built-in Panels")
+	bool ProfilerPanel = true;
+
+	// If enabled, the subsystem captures the log and registers the built-in log panel at "SrgImGui.DrawTree.Log".
+	// Disabled by default since the ring buffer and the history hold about 17 MB.
+	UPROPERTY(config, EditAnywhere, Category = "Built-in Panels")
+	bool LogPanel = false;
+
+	// The maximum memory used by the lines captured for the log panel. The oldest lines are dropped first.
+	UPROPERTY(config, EditAnywhere, Category = "Built-in Panels",
+			  meta = (EditCondition = "LogPanel", ClampMin = "1", Units = "MB"))
+	int32 LogPanelHistorySizeMB = 16;
+
+	// If enabled, the subsystem registers the built-in object table panel at "SrgImGui.DrawTree.ObjectTable".
+	// The panel shows the properties of every live instance of a class as a table.
+	UPROPERTY(config, EditAnywhere, Category = "Built-in Panels")
+	bool ObjectTablePanel = true;
+
+	// If enabled, the subsystem registers the built-in watch panel at "SrgImGui.DrawTree.Watches".
+	// The panel shows the values pinned with SrgImGuiWatches::Pin or the "ImGui - Pin Watch" Blueprint function.
+	UPROPERTY(config, EditAnywhere, Category = "Built-in Panels")
+	bool WatchPanel = true;
+
 	// If enabled, SRG ImGui will work in shipping builds.
 	UPROPERTY(config, EditAnywhere, Category = "Shipping")
 	bool AvailableInShipping = false;
@@ -0,0 +1,75 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+#define SRG_IMGUI_STATS (STATS || CSV_PROFILER)
+
+DECLARE_STATS_GROUP(TEXT("SrgImGui"), STATGROUP_SrgImGui, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Draw Tree"), STAT_SrgImGui_DrawTree, STATGROUP_SrgImGui, SRGIMGUI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Draw Type"), STAT_SrgImGui_DrawType, STATGROUP_SrgImGui, SRGIMGUI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Input Processing"), STAT_SrgImGui_InputProcessing, STATGROUP_SrgImGui, SRGIMGUI_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Nodes Drawn"), STAT_SrgImGui_NodesDrawn, STATGROUP_SrgImGui, SRGIMGUI_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Properties Drawn"), STAT_SrgImGui_PropertiesDrawn, STATGROUP_SrgImGui, SRGIMGUI_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Container Elements Drawn"), STAT_SrgImGui_ContainerElementsDrawn, STATGROUP_SrgImGui,
+								  SRGIMGUI_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("String Conversions"), STAT_SrgImGui_StringConversions, STATGROUP_SrgImGui,
+								  SRGIMGUI_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(SRGIMGUI_API, SrgImGui);
+
+namespace SrgImGuiStats
+{
+	/**
+	 * Counters gathered while drawing.
+	 * Recording a stat message per widget would cost more than the widget itself, so the counters are accumulated here and
+	 * only sent to the stats system and the CSV profiler once per draw. Only updated from the game thread.
+	 */
+	struct FFrameCounters
+	{
+		uint32 NodesDrawn			  = 0;
+		uint32 PropertiesDrawn		  = 0;
+		uint32 ContainerElementsDrawn = 0;
+		uint32 StringConversions	  = 0;
+	};
+
+#if SRG_IMGUI_STATS
+	extern SRGIMGUI_API FFrameCounters GFrameCounters;
+#endif
+
+	FORCEINLINE void CountNodeDrawn()
+	{
+#if SRG_IMGUI_STATS
+		++GFrameCounters.NodesDrawn;
+#endif
+	}
+
+	FORCEINLINE void CountPropertyDrawn()
+	{
+#if SRG_IMGUI_STATS
+		++GFrameCounters.PropertiesDrawn;
+#endif
+	}
+
+	FORCEINLINE void CountContainerElementDrawn()
+	{
+#if SRG_IMGUI_STATS
+		++GFrameCounters.ContainerElementsDrawn;
+#endif
+	}
+
+	FORCEINLINE void CountStringConversion()
+	{
+#if SRG_IMGUI_STATS
+		++GFrameCounters.StringConversions;
+#endif
+	}
+
+	// Sends the accumulated counters to "stat SrgImGui" and the CSV profiler and resets them.
+	SRGIMGUI_API void FlushFrameCounters();
+}	 // namespace SrgImGuiStats
@@ -4,5 +4,8 @@
 
 #include "CoreMinimal.h"
 
-#define TO_IMGUI(Str) reinterpret_cast<const ANSICHAR*>(StringCast<UTF8CHAR>(Str).Get())
+#include "SrgImGuiStats.h"
+
+#define TO_IMGUI(Str) \
+	(SrgImGuiStats::CountStringConversion(), reinterpret_cast<const ANSICHAR*>(StringCast<UTF8CHAR>(Str).Get()))
 #define FROM_IMGUI(Str) StringCast<TCHAR>(Str).Get()
\ No newline at end of file
@@ -12,6 +12,11 @@
 class FSrgImGuiInputProcessor;
 class ISrgImGuiDrawTreeNode;
 
+namespace SrgImGuiMemory
+{
+	class FReport;
+}
+
 DECLARE_LOG_CATEGORY_EXTERN(LogSrgImGui, Log, All);
 
 SRGIMGUI_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_SrgImGui_DrawTree);
@@ -98,12 +103,23 @@ private:
 	void DrawDebugDrawTree();
 	void DrawDebugDrawTree_Internal(const FGameplayTag& NodeTag);
 
+	void RegisterBuiltInPanels();
+	// Forgets what was submitted to the node, unless another subsystem (e.g. of another PIE client) still draws it.
+	void ClearNodeSubmissions(const FGameplayTag& NodeTag) const;
+
+	void GatherMemoryReport(SrgImGuiMemory::FReport& Report) const;
+
 private:
+	// Built-in draw tree nodes owned by the subsystem.
+	UPROPERTY()
+	TArray<TObjectPtr<UObject>> BuiltInPanels;
+
 	TMap<FGameplayTag, TWeakObjectPtr<UObject>> DrawTree_TagsToObjects;
 	TMap<TWeakObjectPtr<UObject>, TSet<FGameplayTag>> DrawTree_ObjectToTags;
 
 	TSharedPtr<FSrgImGuiInputProcessor> InputProcessor;
 	FDelegateHandle ImGuiHandle;
+	FDelegateHandle MemoryReportHandle;
 
 	bool AreChordKeysAsStringCached = false;
 	FString CachedToggleVisibilityChordKeys_Keyboard_AsString;
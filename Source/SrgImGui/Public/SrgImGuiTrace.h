@@ -0,0 +1,71 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+struct FGameplayTag;
+
+#if UE_TRACE_ENABLED && !UE_BUILD_SHIPPING
+#define SRG_IMGUI_TRACE_ENABLED 1
+#else
+#define SRG_IMGUI_TRACE_ENABLED 0
+#endif
+
+#if SRG_IMGUI_TRACE_ENABLED
+UE_TRACE_CHANNEL_EXTERN(SrgImGuiChannel, SRGIMGUI_API);
+#endif
+
+namespace SrgImGuiTrace
+{
+	// Returns true if both the "SrgImGui" and "Cpu" trace channels are enabled (e.g. "-trace=cpu,SrgImGui").
+	FORCEINLINE bool IsEnabled()
+	{
+#if SRG_IMGUI_TRACE_ENABLED
+		return UE_TRACE_CHANNELEXPR_IS_ENABLED(SrgImGuiChannel) && UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuChannel);
+#else
+		return false;
+#endif
+	}
+
+	/**
+	 * Emits a named timing scope to Unreal Insights for a draw tree node or an inspected type.
+	 * Nothing is built or emitted unless the channel is enabled, so the disabled cost is a single branch.
+	 */
+	class FScope : public FNoncopyable
+	{
+	public:
+		explicit FScope(const FGameplayTag& NodeTag)
+		{
+			if (IsEnabled())
+			{
+				BeginNode(NodeTag);
+			}
+		}
+
+		explicit FScope(const UStruct& Type)
+		{
+			if (IsEnabled())
+			{
+				BeginType(Type);
+			}
+		}
+
+		~FScope()
+		{
+			if (IsActive)
+			{
+				End();
+			}
+		}
+
+	private:
+		SRGIMGUI_API void BeginNode(const FGameplayTag& NodeTag);
+		SRGIMGUI_API void BeginType(const UStruct& Type);
+		SRGIMGUI_API void End();
+
+		bool IsActive = false;
+	};
+}	 // namespace SrgImGuiTrace
@@ -0,0 +1,113 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+/**
+ * Lock-free bounded multi-producer queue with a fixed capacity allocated once on construction.
+ * Each cell carries a sequence number that tells producers and consumers whether it is free or ready (Vyukov's bounded queue),
+ * so pushing never allocates or blocks. When the queue is full, TryEnqueue fails and the element is dropped.
+ * Elements are written and read in place, so ElementType should be cheap to copy (e.g. fixed size inline buffers).
+ */
+template <typename ElementType, uint32 Capacity>
+class TSrgImGuiBoundedQueue : public FNoncopyable
+{
+	static_assert(Capacity > 1 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+
+public:
+	TSrgImGuiBoundedQueue()
+		: Cells(MakeUnique<FCell[]>(Capacity))
+	{
+		for (uint32 Index = 0; Index < Capacity; ++Index)
+		{
+			Cells[Index].Sequence.store(Index, std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * Reserves a cell and calls WriteElement(ElementType&) to fill it in place. Safe to call from any thread.
+	 * @return False if the queue is full. WriteElement is not called in that case.
+	 */
+	template <typename WriteFunctorType>
+	bool TryEnqueue(WriteFunctorType&& WriteElement)
+	{
+		uint32 Position = EnqueuePosition.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			FCell& Cell			  = Cells[Position & INDEX_MASK];
+			const uint32 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+			const int32 Distance  = static_cast<int32>(Sequence - Position);
+			if (Distance == 0)
+			{
+				if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+				{
+					WriteElement(Cell.Element);
+					Cell.Sequence.store(Position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (Distance < 0)
+			{
+				return false;
+			}
+			else
+			{
+				Position = EnqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/**
+	 * Calls ReadElement(const ElementType&) on the oldest element and frees its cell.
+	 * @return False if the queue is empty.
+	 */
+	template <typename ReadFunctorType>
+	bool TryDequeue(ReadFunctorType&& ReadElement)
+	{
+		uint32 Position = DequeuePosition.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			FCell& Cell			  = Cells[Position & INDEX_MASK];
+			const uint32 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+			const int32 Distance  = static_cast<int32>(Sequence - (Position + 1));
+			if (Distance == 0)
+			{
+				if (DequeuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+				{
+					ReadElement(static_cast<const ElementType&>(Cell.Element));
+					Cell.Sequence.store(Position + Capacity, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (Distance < 0)
+			{
+				return false;
+			}
+			else
+			{
+				Position = DequeuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	static constexpr uint32 GetCapacity() { return Capacity; }
+	static constexpr SIZE_T GetAllocatedSize() { return sizeof(FCell) * Capacity; }
+
+private:
+	static constexpr uint32 INDEX_MASK = Capacity - 1;
+
+	struct FCell
+	{
+		std::atomic<uint32> Sequence{0};
+		ElementType Element;
+	};
+
+	TUniquePtr<FCell[]> Cells;
+
+	// Producers and the consumer write to these constantly, so they are kept on separate cache lines.
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> EnqueuePosition{0};
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> DequeuePosition{0};
+};
@@ -0,0 +1,81 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+/**
+ * Fixed memory histogram of integer samples (e.g. latencies in microseconds) with HDR histogram style buckets.
+ * Values below 64 get a bucket each. Above that, every power of two is split into 32 buckets, so any recorded value is
+ * known within ~3% of its real value. Values up to 2^40 are supported and bigger ones are clamped.
+ * Recording is a few relaxed atomic operations, so samples can be recorded from any thread without locks. Histograms recorded
+ * on different threads (or over different periods) can be merged into one.
+ *
+ * static FSrgImGuiLatencyHistogram RoundTripHistogram;
+ * RoundTripHistogram.RecordValue(RoundTripMicroseconds);
+ * ...
+ * RoundTripHistogram.DrawDistribution(TEXT("Round Trip"), TEXT("us"));
+ */
+class SRGIMGUI_API FSrgImGuiLatencyHistogram : public FNoncopyable
+{
+public:
+	static constexpr int32 SUB_BUCKET_BITS	= 5;
+	static constexpr int32 SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+	static constexpr int32 MAX_VALUE_BITS	= 40;
+	static constexpr uint64 MAX_VALUE		= (uint64(1) << MAX_VALUE_BITS) - 1;
+	static constexpr int32 NUM_BUCKETS		= (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+	FSrgImGuiLatencyHistogram();
+
+	// Safe to call from any thread.
+	void RecordValue(uint64 Value);
+
+	// Records a duration in microseconds. Safe to call from any thread.
+	void RecordSeconds(double Seconds)
+	{
+		RecordValue(static_cast<uint64>(FMath::Clamp(Seconds * 1000000.0, 0.0, static_cast<double>(MAX_VALUE))));
+	}
+
+	// Adds every sample of Other to this histogram. Safe to call while other threads record to either histogram.
+	void Merge(const FSrgImGuiLatencyHistogram& Other);
+
+	// Samples recorded while resetting may be partially lost.
+	void Reset();
+
+	uint64 GetTotalCount() const { return TotalCount.load(std::memory_order_relaxed); }
+	uint64 GetMinValue() const;
+	uint64 GetMaxValue() const { return MaxValue.load(std::memory_order_relaxed); }
+	double GetMean() const;
+
+	// Returns the highest value that is equivalent (same bucket) to the value at this percentile. 0 if empty.
+	uint64 GetValueAtPercentile(double Percentile) const;
+
+	/**
+	 * Computes several percentiles with a single pass over the buckets.
+	 * @param Percentiles Percentiles in the [0, 100] range, in ascending order.
+	 * @param OutValues Receives the value at each percentile. Must have the same size as Percentiles.
+	 */
+	void GetValuesAtPercentiles(TConstArrayView<double> Percentiles, TArrayView<uint64> OutValues) const;
+
+	/**
+	 * Draws the distribution of the samples as a bar per power of two, followed by the count, mean, p50, p90, p99 and max.
+	 * Must be called from the game thread while drawing ImGui.
+	 * @param Label The label for this widget.
+	 * @param Unit Unit shown next to the values (e.g. "us").
+	 * @param Size The size of the plot widget. (0,0) means it will use the default size.
+	 */
+	void DrawDistribution(const TCHAR* Label, const TCHAR* Unit = TEXT(""), FVector2D Size = FVector2D::ZeroVector) const;
+
+	static int32 GetBucketIndex(uint64 Value);
+	// Highest value that falls into this bucket.
+	static uint64 GetBucketHighestValue(int32 BucketIndex);
+
+private:
+	std::atomic<uint64> Counts[NUM_BUCKETS];
+	std::atomic<uint64> TotalCount{0};
+	std::atomic<uint64> TotalSum{0};
+	std::atomic<uint64> MinValue{MAX_uint64};
+	std::atomic<uint64> MaxValue{0};
+};
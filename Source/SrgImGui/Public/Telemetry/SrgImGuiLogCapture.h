@@ -0,0 +1,60 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Captures the log (UE_LOG and everything else that goes through GLog) so that it can be inspected in ImGui on any device.
+ * Logging threads write each line in place to a lock-free ring buffer, so capturing never blocks or allocates. Every frame,
+ * the game thread moves the lines from the ring buffer to a history bounded by bytes, which drops its oldest lines first.
+ * Lines are stored as UTF-8 and can be drawn without any string conversion.
+ */
+namespace SrgImGuiLogCapture
+{
+	struct FCategory
+	{
+		FName Name;
+		// The name as a null terminated UTF-8 string, as expected by ImGui.
+		TArray<ANSICHAR> Utf8;
+		int32 NumLines = 0;
+	};
+
+	struct FLine
+	{
+		// Not null terminated.
+		const ANSICHAR* Text = nullptr;
+		int32 Length		 = 0;
+
+		// Seconds since the engine started.
+		double Time					  = 0.0;
+		int32 CategoryIndex			  = 0;
+		ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+	};
+
+	// Starts capturing if not capturing yet. The history keeps at most MaxHistoryBytes of lines.
+	SRGIMGUI_API void Start(SIZE_T MaxHistoryBytes);
+
+	// Stops capturing and frees the history.
+	SRGIMGUI_API void Stop();
+
+	SRGIMGUI_API bool IsCapturing();
+
+	// The following functions are called from the game thread only.
+
+	// Lines are numbered in the order they were captured. The history holds [GetFirstLine(), GetEndLine()).
+	SRGIMGUI_API uint64 GetFirstLine();
+	SRGIMGUI_API uint64 GetEndLine();
+
+	// The line must be in the history. Its text is valid until the next frame.
+	SRGIMGUI_API FLine GetLine(uint64 LineNumber);
+
+	// Every category seen since the capture started. FLine::CategoryIndex indexes into it.
+	SRGIMGUI_API const TArray<FCategory>& GetCategories();
+
+	// Lines dropped because the ring buffer was full, since the capture started.
+	SRGIMGUI_API uint32 GetNumDropped();
+
+	// Forgets every captured line. The categories are kept.
+	SRGIMGUI_API void Clear();
+}	 // namespace SrgImGuiLogCapture
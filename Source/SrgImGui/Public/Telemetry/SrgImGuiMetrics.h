@@ -0,0 +1,74 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class ESrgImGuiMetricType : uint8
+{
+	// Accumulates deltas. Shown as its total and its rate per second.
+	Counter,
+	// Holds the last value set.
+	Gauge
+};
+
+/**
+ * Handle to a named metric of the SRG ImGui metrics registry. Cheap to copy and safe to update from any thread.
+ * Counters are sharded per thread, so updating them is an uncontended atomic add that never touches ImGui. The shards are
+ * only aggregated once per frame while ImGui is visible.
+ * Handles are meant to be created once and cached (e.g. as statics):
+ *
+ * static const FSrgImGuiMetric RequestsMetric = FSrgImGuiMetric::FindOrAddCounter(TEXT("Http.Requests"));
+ * RequestsMetric.Add();
+ */
+class SRGIMGUI_API FSrgImGuiMetric
+{
+public:
+	FSrgImGuiMetric() = default;
+
+	// Returns the counter with this name, creating it if needed. Invalid if the registry is full or the name is a gauge.
+	static FSrgImGuiMetric FindOrAddCounter(FName Name);
+	// Returns the gauge with this name, creating it if needed. Invalid if the registry is full or the name is a counter.
+	static FSrgImGuiMetric FindOrAddGauge(FName Name);
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+
+	// Counters only.
+	void Add(int64 Delta = 1) const;
+
+	// Gauges only.
+	void Set(double Value) const;
+
+private:
+	explicit FSrgImGuiMetric(int32 InIndex)
+		: Index(InIndex)
+	{
+	}
+
+	static FSrgImGuiMetric FindOrAdd(FName Name, ESrgImGuiMetricType Type);
+
+	int32 Index = INDEX_NONE;
+};
+
+namespace SrgImGuiMetrics
+{
+	struct FMetricSnapshot
+	{
+		FName Name;
+		ESrgImGuiMetricType Type = ESrgImGuiMetricType::Counter;
+		// The counter total or the gauge value.
+		double Value		 = 0.0;
+		double RatePerSecond = 0.0;
+		// Ring buffer with the rate (counters) or value (gauges) of the last aggregations. HistoryOffset is the oldest sample.
+		TArray<float> History;
+		int32 HistoryOffset = 0;
+	};
+
+	// The following functions are called from the game thread only.
+
+	// Sums the shards of every metric and records their history. Does nothing if it was already called this frame.
+	SRGIMGUI_API void Aggregate();
+
+	// Snapshots as of the last aggregation, in registration order.
+	SRGIMGUI_API const TArray<FMetricSnapshot>& GetSnapshots();
+}	 // namespace SrgImGuiMetrics
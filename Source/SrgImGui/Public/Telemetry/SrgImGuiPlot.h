@@ -0,0 +1,57 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Line plots that stay cheap with very large numbers of samples.
+ * When a series has more visible samples than the plot has pixels, it is decimated to the min and max of the samples under
+ * each pixel (computed with SIMD), so the cost of drawing depends on the width of the plot and spikes are never aliased away.
+ * The decimation of series with a version is cached and only recomputed when the version, the view or the width changes.
+ * Plots can be zoomed with the mouse wheel, panned by dragging and reset by double clicking.
+ */
+namespace SrgImGuiPlot
+{
+	// Samples of a series as up to two contiguous runs (e.g. the two halves of a ring buffer). First holds the oldest samples.
+	struct FSamples
+	{
+		TConstArrayView<float> First;
+		TConstArrayView<float> Second;
+
+		int32 Num() const { return First.Num() + Second.Num(); }
+
+		float operator[](int32 Index) const { return Index < First.Num() ? First[Index] : Second[Index - First.Num()]; }
+	};
+
+	struct FSeries
+	{
+		FSamples Samples;
+		// Shown in the legend and tooltips. Optional.
+		const TCHAR* Name = nullptr;
+		// Transparent picks a color automatically.
+		FLinearColor Color = FLinearColor::Transparent;
+		// Must change whenever the samples change so that the decimation can be cached. 0 decimates every frame.
+		uint64 Version = 0;
+	};
+
+	struct FOptions
+	{
+		// Optional text to show on top of the plot.
+		const TCHAR* OverlayText = nullptr;
+		// The size of the plot widget. (0,0) means it will use the default size.
+		FVector2D Size = FVector2D::ZeroVector;
+		// The range of the plot. FLT_MAX fits it to the visible samples.
+		float Min = FLT_MAX;
+		float Max = FLT_MAX;
+	};
+
+	// Expands InOutMin and InOutMax to contain every sample, four samples at a time.
+	SRGIMGUI_API void ComputeMinMax(TConstArrayView<float> Samples, float& InOutMin, float& InOutMax);
+
+	/**
+	 * Draws one or more series as lines on the same plot, aligned on their latest sample.
+	 * Hovering the plot shows the value of every series under the cursor. Several series also show a legend.
+	 */
+	SRGIMGUI_API void Lines(const TCHAR* Label, TConstArrayView<FSeries> Series, const FOptions& Options = FOptions());
+}	 // namespace SrgImGuiPlot
@@ -0,0 +1,131 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#ifndef SRG_IMGUI_PROFILER_ENABLED
+#define SRG_IMGUI_PROFILER_ENABLED !UE_BUILD_SHIPPING
+#endif
+
+#if SRG_IMGUI_PROFILER_ENABLED
+// Times the rest of the current scope in the SRG ImGui profiler. Name is an identifier (e.g. SRG_IMGUI_SCOPE(UpdatePaths)).
+#define SRG_IMGUI_SCOPE(Name) SRG_IMGUI_SCOPE_STR(TEXT(#Name))
+// Same as SRG_IMGUI_SCOPE but takes a string literal (e.g. SRG_IMGUI_SCOPE_STR(TEXT("Update Paths"))).
+#define SRG_IMGUI_SCOPE_STR(NameStr)                                                                    \
+	static const SrgImGuiProfiler::FScopeName PREPROCESSOR_JOIN(SrgImGuiScopeName_, __LINE__)(NameStr); \
+	const SrgImGuiProfiler::FScope PREPROCESSOR_JOIN(SrgImGuiScope_, __LINE__)(PREPROCESSOR_JOIN(SrgImGuiScopeName_, __LINE__))
+#else
+#define SRG_IMGUI_SCOPE(Name)
+#define SRG_IMGUI_SCOPE_STR(NameStr)
+#endif
+
+#if SRG_IMGUI_PROFILER_ENABLED
+// Toggled by the "SrgImGui.Profiler.Enabled" console variable and the profiler panel.
+extern SRGIMGUI_API bool GSrgImGuiProfilerEnabled;
+#endif
+
+/**
+ * Lightweight hierarchical profiler for day to day tuning without leaving the game.
+ * Scopes are recorded into a ring buffer per thread, so recording never locks: a scope is two timestamps and two writes to
+ * the ring of the current thread. When the profiler is disabled, a scope costs a single branch.
+ * Every frame, USrgImGuiSubsystem collects the rings into a frame capture. The last frames are kept for the profiler panel,
+ * which shows them as a call tree and as a flame graph.
+ */
+namespace SrgImGuiProfiler
+{
+	// Registers a scope name once. Used through SRG_IMGUI_SCOPE.
+	class SRGIMGUI_API FScopeName : public FNoncopyable
+	{
+	public:
+		explicit FScopeName(const TCHAR* Name);
+
+		uint32 GetIndex() const { return Index; }
+
+	private:
+		uint32 Index = 0;
+	};
+
+	// Used through SRG_IMGUI_SCOPE.
+	class FScope : public FNoncopyable
+	{
+	public:
+		explicit FScope(const FScopeName& Name)
+		{
+#if SRG_IMGUI_PROFILER_ENABLED
+			if (GSrgImGuiProfilerEnabled)
+			{
+				NameIndex = Name.GetIndex();
+				RecordEvent(NameIndex, true);
+				IsActive = true;
+			}
+#endif
+		}
+
+		~FScope()
+		{
+			if (IsActive)
+			{
+				RecordEvent(NameIndex, false);
+			}
+		}
+
+	private:
+		static SRGIMGUI_API void RecordEvent(uint32 NameIndex, bool IsBegin);
+
+		uint32 NameIndex = 0;
+		bool IsActive	 = false;
+	};
+
+	// A scope that ended during a captured frame.
+	struct FScopeRecord
+	{
+		uint64 StartCycles = 0;
+		uint64 EndCycles   = 0;
+		uint32 NameIndex   = 0;
+		// 0 for scopes without a parent.
+		int32 Depth = 0;
+	};
+
+	struct FThreadCapture
+	{
+		uint32 ThreadId = 0;
+		FString ThreadName;
+		// In the order the scopes ended.
+		TArray<FScopeRecord> Scopes;
+		// Scopes dropped because the thread recorded too many in this frame.
+		int32 NumDroppedScopes = 0;
+	};
+
+	struct FFrameCapture
+	{
+		uint64 FrameNumber = 0;
+		uint64 StartCycles = 0;
+		uint64 EndCycles   = 0;
+		TArray<FThreadCapture> Threads;
+
+		double GetDurationMs() const { return (EndCycles - StartCycles) * FPlatformTime::GetSecondsPerCycle64() * 1000.0; }
+	};
+
+	SRGIMGUI_API bool IsEnabled();
+	SRGIMGUI_API void SetEnabled(bool Enabled);
+
+	// The following functions are called from the game thread only.
+
+	// Moves the scopes recorded since the last call into a new frame capture. Does nothing if already called this frame.
+	SRGIMGUI_API void CollectFrame();
+
+	// While frozen, the recorded scopes are still collected but no new frame capture is kept.
+	SRGIMGUI_API bool IsFrozen();
+	SRGIMGUI_API void SetFrozen(bool Frozen);
+
+	// Number of frame captures kept. Age 0 is the latest one.
+	SRGIMGUI_API int32 GetNumFrames();
+	SRGIMGUI_API const FFrameCapture& GetFrame(int32 Age);
+
+	// The longest frame captured since the profiler was enabled or the worst frame was reset.
+	SRGIMGUI_API const FFrameCapture* GetWorstFrame();
+	SRGIMGUI_API void ResetWorstFrame();
+
+	SRGIMGUI_API const TCHAR* GetScopeName(uint32 NameIndex);
+}	 // namespace SrgImGuiProfiler
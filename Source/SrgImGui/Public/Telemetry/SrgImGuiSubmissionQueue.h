@@ -0,0 +1,37 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+/**
+ * Lets any thread (async tasks, physics callbacks, loading threads...) feed debug data to the draw tree.
+ * Submissions go into a lock-free bounded queue and cost a fixed-size copy. If the queue is full they are dropped instead of
+ * blocking. Every frame, USrgImGuiSubsystem drains the queue and draws the latest submissions of each draw tree node right
+ * after the node's "Start" call, before its children.
+ * Labels are truncated to 31 characters and texts to 127 characters. Labels that are not submitted to for 600 frames are
+ * forgotten, and a node's submissions are cleared when it is unregistered from the draw tree of every world that had it.
+ */
+namespace SrgImGuiSubmission
+{
+	// Shows the latest text submitted with this label.
+	SRGIMGUI_API bool SubmitText(const FGameplayTag& NodeTag, FStringView Label, FStringView Text);
+
+	// Shows the latest value submitted with this label.
+	SRGIMGUI_API bool SubmitValue(const FGameplayTag& NodeTag, FStringView Label, double Value);
+
+	// Adds a sample to the plot with this label. Each plot keeps the last 128 samples.
+	SRGIMGUI_API bool SubmitPlotSample(const FGameplayTag& NodeTag, FStringView Label, float Sample);
+
+	// The following functions are called from the game thread only.
+
+	// Moves every pending submission to the node it was submitted to.
+	SRGIMGUI_API void DrainQueue();
+
+	// Draws everything that was submitted to the node.
+	SRGIMGUI_API void DrawNodeSubmissions(const FGameplayTag& NodeTag);
+
+	// Forgets everything that was submitted to the node.
+	SRGIMGUI_API void ClearNodeSubmissions(const FGameplayTag& NodeTag);
+}	 // namespace SrgImGuiSubmission
@@ -0,0 +1,127 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Telemetry/SrgImGuiPlot.h"
+
+#include "SrgImGuiTimeSeries.generated.h"
+
+/**
+ * Fixed capacity ring buffer of float samples that can be plotted directly from its storage.
+ * Pushing a sample is O(1) and never allocates. Once full, each push overwrites the oldest sample.
+ * Only meant to be used from the game thread. Use SrgImGuiSubmission::SubmitPlotSample to plot from other threads.
+ */
+class SRGIMGUI_API FSrgImGuiTimeSeries
+{
+public:
+	explicit FSrgImGuiTimeSeries(int32 InCapacity = 128);
+
+	void Push(float Sample);
+	void Reset();
+
+	// Removes every sample.
+	void SetCapacity(int32 NewCapacity);
+
+	int32 Num() const { return NumSamples; }
+	int32 GetCapacity() const { return Samples.Num(); }
+	bool IsEmpty() const { return NumSamples == 0; }
+
+	// Index 0 is the oldest sample.
+	float operator[](int32 Index) const
+	{
+		checkSlow(Index >= 0 && Index < NumSamples);
+		const int32 StorageIndex = OldestIndex + Index;
+		return Samples[StorageIndex < Samples.Num() ? StorageIndex : StorageIndex - Samples.Num()];
+	}
+
+	// Returns 0 if empty.
+	float GetLatest() const { return NumSamples > 0 ? (*this)[NumSamples - 1] : 0.0f; }
+
+	// The raw ring storage. The oldest sample is at GetOldestIndex(), as expected by the "values_offset" of ImGui's plots.
+	const float* GetData() const { return Samples.GetData(); }
+	int32 GetOldestIndex() const { return OldestIndex; }
+
+	// The samples in the ring storage, from the oldest to the latest.
+	SrgImGuiPlot::FSamples GetSamples() const;
+
+	// Changes every time the samples change.
+	uint64 GetVersion() const { return Version; }
+
+	SIZE_T GetAllocatedSize() const { return Samples.GetAllocatedSize() + Name.GetAllocatedSize(); }
+
+	// Shown in the legend and tooltips of plots with several series.
+	FString Name;
+	// Transparent picks a color automatically.
+	FLinearColor Color = FLinearColor::Transparent;
+
+private:
+	TArray<float> Samples;
+	int32 NumSamples  = 0;
+	int32 OldestIndex = 0;
+	uint64 Version	  = 1;
+};
+
+namespace SrgImGuiTimeSeries
+{
+	/**
+	 * Draws one or more time series as lines on the same plot with SrgImGuiPlot::Lines.
+	 * Series with more samples than the plot has pixels are decimated, and the decimation is cached until the series change.
+	 * @param Label The label for this widget.
+	 * @param Series The series to draw. Null entries are ignored.
+	 * @param OverlayText Optional text to show on top of the plot.
+	 * @param Size The size of the plot widget. (0,0) means it will use the default size.
+	 * @param Min The minimum value of the plot. FLT_MAX fits it to the samples.
+	 * @param Max The maximum value of the plot. FLT_MAX fits it to the samples.
+	 */
+	SRGIMGUI_API void Plot(const TCHAR* Label, TConstArrayView<const FSrgImGuiTimeSeries*> Series,
+						   const TCHAR* OverlayText = TEXT(""), FVector2D Size = FVector2D::ZeroVector, float Min = FLT_MAX,
+						   float Max = FLT_MAX);
+}	 // namespace SrgImGuiTimeSeries
+
+/**
+ * Blueprint handle to a time series. Create it with "ImGui - Create Time Series", push samples to it every frame and draw it
+ * with "ImGui - Plot Time Series".
+ */
+UCLASS(BlueprintType)
+class SRGIMGUI_API USrgImGuiTimeSeries : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Creates a time series.
+	 * @param Owner The object that owns the time series.
+	 * @param Name Shown in the legend and tooltips of plots with several series.
+	 * @param Capacity The number of samples kept.
+	 * @param Color The color of the series. Transparent picks a color automatically.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Time Series",
+			  meta = (DefaultToSelf = "Owner", DisplayName = "ImGui - Create Time Series", AdvancedDisplay = "Color"))
+	static USrgImGuiTimeSeries* CreateTimeSeries(UObject* Owner, const FString& Name,
+												 UPARAM(meta = (ClampMin = 2)) int32 Capacity = 128,
+												 FLinearColor Color = FLinearColor::Transparent);
+
+	// Adds a sample. Once full, the oldest sample is overwritten.
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Time Series")
+	void Push(float Sample);
+
+	// Removes every sample.
+	UFUNCTION(BlueprintCallable, Category = "SRG ImGui|Time Series")
+	void Reset();
+
+	// Returns 0 if there are no samples.
+	UFUNCTION(BlueprintPure, Category = "SRG ImGui|Time Series")
+	float GetLatest() const;
+
+	UFUNCTION(BlueprintPure, Category = "SRG ImGui|Time Series")
+	int32 Num() const;
+
+	FSrgImGuiTimeSeries& GetSeries() { return Series; }
+	const FSrgImGuiTimeSeries& GetSeries() const { return Series; }
+
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
+private:
+	FSrgImGuiTimeSeries Series;
+};
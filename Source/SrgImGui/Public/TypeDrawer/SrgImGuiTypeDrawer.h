@@ -12,6 +12,14 @@ namespace SrgImGuiTypeDrawer_Private
 {
 	bool DrawProperty(void* ContainerPtr, FProperty* Property, const FDrawingContext& DrawingContext);
 	bool DrawPropertyValue(void* ContainerPtr, FProperty* Property, int32 ArrayIndex, const FDrawingContext& DrawingContext);
+
+	// Returns the function that draws values of the type of the property, or nullptr if the type is not supported.
+	// Lets callers that draw the same property for many containers look it up once.
+	const FDrawPropertyValueFunction* FindDrawPropertyValueFunction(const FProperty& Property);
+
+	// Returns the ImGuiTreeNodeFlags to use for the collapsing headers drawn with this context. Must be called right before the
+	// header is drawn, as it opens the headers on the path to a search match.
+	int32 GetCollapsingHeaderFlags(const FDrawingContext& DrawingContext);
 }	 // namespace SrgImGuiTypeDrawer_Private
 
 namespace SrgImGuiTypeDrawer
@@ -34,10 +42,23 @@ namespace SrgImGuiTypeDrawer
 	}
 
 	bool SRGIMGUI_API DrawEnumValue(uint8& Value, UEnum* Enum, bool Mutable);
+	bool SRGIMGUI_API DrawBytesValue(TArrayView<uint8> Bytes, bool Mutable);
 	bool SRGIMGUI_API DrawClassValue(UClass*& Class, UClass* ParentClass, bool Mutable);
-	bool SRGIMGUI_API DrawStructValue(void* StructData, UScriptStruct* Struct, bool Mutable, bool HasCollapsingHeader);
-	bool SRGIMGUI_API DrawObjectValue(UObject* Object, bool HasCollapsingHeader, bool ForceDrawDefault = false);
+	bool SRGIMGUI_API DrawSoftClassValue(FSoftObjectPtr& SoftClass, UClass* MetaClass, bool Mutable);
+	// HasSearch draws a search box that only shows the properties whose path (e.g. "Stats.Damage") matches it.
+	bool SRGIMGUI_API DrawStructValue(void* StructData, UScriptStruct* Struct, bool Mutable, bool HasCollapsingHeader,
+									  bool ExpandHeaders = false, bool HasSearch = false);
+	// Draws Count structs stored every Stride bytes from Base as a table, without copying them.
+	bool SRGIMGUI_API DrawStructArrayValue(void* Base, int32 Count, int32 Stride, UScriptStruct* Struct, bool Mutable,
+										   bool HasCollapsingHeader);
+	bool SRGIMGUI_API DrawObjectValue(UObject* Object, bool HasCollapsingHeader, bool ForceDrawDefault = false,
+									  bool ExpandHeaders = false, bool HasSearch = false);
 
 	bool SRGIMGUI_API DrawPropertyValue(void* ContainerPtr, FProperty* Property, bool Mutable, bool HasCollapsingHeader,
 										int32 ArrayIndex);
+
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnUnsupportedProperty, const FProperty& /*Property*/);
+
+	// Broadcast every time a property that has no drawer for its type is drawn.
+	SRGIMGUI_API FOnUnsupportedProperty& OnUnsupportedProperty();
 }	 // namespace SrgImGuiTypeDrawer
\ No newline at end of file
@@ -6,6 +6,8 @@
 
 namespace SrgImGuiTypeDrawer_Private
 {
+	struct FPropertySearch;
+
 	struct SRGIMGUI_API FDrawingContext
 	{
 		bool HasCollapsingHeader = true;
@@ -14,5 +16,18 @@ namespace SrgImGuiTypeDrawer_Private
 		FString FieldName;
 		bool Mutable   = false;
 		bool MultiLine = false;
+		// Opens every collapsing header by default, except the ones of referenced objects. Used when everything needs to be drawn
+		// (e.g. benchmarks).
+		bool ExpandHeaders = false;
+		// Draws a search box above the properties of the inspected object or struct. Cleared once the box is drawn.
+		bool HasSearch = false;
+		// Set while a property search is active: only the properties on the path to a match are drawn, starting at the children
+		// of SearchEntry in its index.
+		FPropertySearch* Search = nullptr;
+		int32 SearchEntry		= INDEX_NONE;
 	};
+
+	// Draws the value at ArrayIndex of a property of the given type that lives in ContainerPtr. Returns true if it was modified.
+	using FDrawPropertyValueFunction =
+		TFunction<bool(void* /*ContainerPtr*/, int32 /*ArrayIndex*/, FProperty&, const FDrawingContext&)>;
 }	 // namespace SrgImGuiTypeDrawer_Private
\ No newline at end of file
@@ -0,0 +1,13 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TypeDrawer/SrgImGuiTypeDrawerTypes.h"
+
+namespace SrgImGuiTypeDrawer_Private
+{
+	// Draws the bytes as a hex dump with an ASCII column. Only the visible rows are formatted.
+	bool DrawBytesValue(TArrayView<uint8> Bytes, const FDrawingContext& Context);
+}	 // namespace SrgImGuiTypeDrawer_Private
@@ -10,5 +10,6 @@ namespace SrgImGuiTypeDrawer_Private
 {
 	bool DrawClassValue(UClass*& Class, UClass* ParentClass, const FDrawingContext& Context);
 	bool DrawClassPropertyValue(void* ContainerPtr, int32 ArrayIndex, FProperty& Property, const FDrawingContext& Context);
+	bool DrawSoftClassValue(FSoftObjectPtr& SoftClass, UClass* MetaClass, const FDrawingContext& Context);
 	bool DrawSoftClassPropertyValue(void* ContainerPtr, int32 ArrayIndex, FProperty& Property, const FDrawingContext& Context);
 }	 // namespace SrgImGuiTypeDrawer_Private
\ No newline at end of file
@@ -0,0 +1,16 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TypeDrawer/SrgImGuiTypeDrawerTypes.h"
+
+class UDataTable;
+
+namespace SrgImGuiTypeDrawer_Private
+{
+	// Draws the rows of the data table as a table with one column per property of its row struct. The rows that pass the filter
+	// and their sorted order are computed once and kept until the table or the filter changes.
+	bool DrawDataTableRows(UDataTable& DataTable, const FDrawingContext& Context);
+}	 // namespace SrgImGuiTypeDrawer_Private
@@ -0,0 +1,28 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TypeDrawer/SrgImGuiTypeDrawerTypes.h"
+
+namespace SrgImGuiTypeDrawer_Private
+{
+	// Draws the search box of an inspector of Struct (a struct or a class). While the search is active, Context is set to only
+	// draw the properties whose path matches it and the properties that lead to them.
+	void DrawPropertySearch(const UStruct& Struct, FDrawingContext& Context);
+
+	// Returns true if the search of the context applies to the properties of Struct. If it does not (e.g. the key of a map whose
+	// values are searched), every property of Struct is drawn without the search.
+	bool IsSearchingProperties(const UStruct& Struct, const FDrawingContext& Context);
+
+	// Returns true if a property of Struct is on the path to a search match. Properties of its super structs are included if
+	// IncludeSuper is set.
+	bool HasSearchedProperties(const UStruct& Struct, bool IncludeSuper, const FDrawingContext& Context);
+
+	// Calls Visit with each property of Struct that is on the path to a search match, in order, and the context to draw it with.
+	// Properties of its super structs are included if IncludeSuper is set. The subtrees that do not match are skipped without
+	// being walked.
+	void ForEachSearchedProperty(const UStruct& Struct, bool IncludeSuper, const FDrawingContext& Context,
+								 TFunctionRef<void(FProperty&, const FDrawingContext&)> Visit);
+}	 // namespace SrgImGuiTypeDrawer_Private
@@ -0,0 +1,76 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Library/SrgImGuiLabel.h"
+#include "TypeDrawer/SrgImGuiTypeDrawerTypes.h"
+
+namespace SrgImGuiTypeDrawer_Private
+{
+	// The value of a property reduced to something every property type can be sorted and filtered by. Values are compared by
+	// number first, then by text.
+	struct FSortKey
+	{
+		double Number = 0.0;
+		FString Text;
+		// Numbers, enums and bools only set Number.
+		bool IsNumber = false;
+
+		bool operator<(const FSortKey& Other) const
+		{
+			if (Number != Other.Number)
+			{
+				return Number < Other.Number;
+			}
+			return Text.Compare(Other.Text, ESearchCase::IgnoreCase) < 0;
+		}
+	};
+
+	void SRGIMGUI_API GetSortKey(const FProperty& Property, const void* ValuePtr, FSortKey& OutKey);
+
+	// The properties drawn as the columns of a table. Compiled once per type and shared by every row, so drawing a cell does not
+	// look up anything.
+	struct SRGIMGUI_API FPropertyTablePlan
+	{
+		struct FColumn
+		{
+			FProperty* Property							= nullptr;
+			const FDrawPropertyValueFunction* DrawValue = nullptr;
+			FSrgImGuiLabel Label;
+		};
+
+		// Plans the named properties of the struct, in order, or all of its properties if no names are given. Properties that
+		// cannot be drawn or are static arrays are skipped.
+		static FPropertyTablePlan Compile(const UStruct& Struct, TConstArrayView<FName> PropertyNames = {});
+
+		TWeakObjectPtr<const UStruct> Struct;
+		TArray<FColumn> Columns;
+	};
+
+	// The order of the rows of a table, sorted by one of its columns. The order is kept until the sort column or the number of
+	// rows change, or until it is invalidated (e.g. when the rows are gathered again), so a table is not sorted every frame.
+	struct SRGIMGUI_API FPropertyTableSort
+	{
+		void Invalidate() { Valid = false; }
+
+		TArray<int32> Order;
+		// The planned column to sort by, or INDEX_NONE to keep the order of the rows.
+		int32 Column	= INDEX_NONE;
+		bool Descending = false;
+		bool Valid		= false;
+	};
+
+	// Draws NumRows rows as a table, with a first column (named HeaderLabel and drawn by DrawRowHeader) followed by one column
+	// per planned property. GetRow returns the memory the properties of a row are read from, or nullptr if the row is gone.
+	// Only the visible rows are drawn. Returns true if a value was modified.
+	bool SRGIMGUI_API DrawPropertyTable(const ANSICHAR* Id, const FPropertyTablePlan& Plan, int32 NumRows,
+										TFunctionRef<void*(int32)> GetRow, const ANSICHAR* HeaderLabel,
+										TFunctionRef<void(int32)> DrawRowHeader, FPropertyTableSort& Sort,
+										const FDrawingContext& Context);
+
+	// Draws Count structs laid out every Stride bytes from Base (e.g. the fragments of a chunk) as a table with one row per
+	// struct. The plan of the struct is compiled once and shared by every span of that struct.
+	bool DrawStructArrayValue(void* Base, int32 Count, int32 Stride, UScriptStruct& Struct, const FDrawingContext& Context);
+}	 // namespace SrgImGuiTypeDrawer_Private
@@ -0,0 +1,414 @@
+// © Surgent Studios
+
+#include "SrgImGuiBenchmarkCommandlet.h"
+
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/StructOnScope.h"
+
+#include "SrgImGuiHeadlessContext.h"
+#include "Interfaces/SrgImGuiMutable.h"
+#include "TypeDrawer/SrgImGuiTypeDrawer.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSrgImGuiBenchmark, Log, All);
+
+namespace SrgImGuiBenchmark_Private
+{
+	static constexpr EObjectFlags SYNTHETIC_FLAGS		= RF_Public | RF_Transient;
+	static constexpr int32 NUM_SCALAR_PROPERTY_TYPES	= 6;
+	static constexpr int32 PROPERTIES_PER_NESTED_STRUCT = 10;
+
+	// Every generated struct and class. Kept rooted until the benchmark finishes.
+	static TArray<UStruct*> SyntheticTypes;
+
+	struct FBenchmarkCase
+	{
+		FString Name;
+		FString Category;
+		int32 NumProperties		   = 0;
+		int32 NumContainerElements = 0;
+		bool Mutable			   = false;
+
+		// Either a struct instance or an object is drawn.
+		UScriptStruct* Struct = nullptr;
+		TSharedPtr<FStructOnScope> StructData;
+		UObject* Object = nullptr;
+	};
+
+	struct FBenchmarkResult
+	{
+		double MinMs	= 0.0;
+		double MedianMs = 0.0;
+		double MeanMs	= 0.0;
+		double MaxMs	= 0.0;
+		int32 Vertices	= 0;
+	};
+
+	FProperty* AddScalarProperty(FFieldVariant Owner, const FName Name, int32 TypeIndex)
+	{
+		switch (TypeIndex % NUM_SCALAR_PROPERTY_TYPES)
+		{
+			case 0:
+				return new FIntProperty(Owner, Name, SYNTHETIC_FLAGS);
+			case 1:
+				return new FFloatProperty(Owner, Name, SYNTHETIC_FLAGS);
+			case 2:
+			{
+				FBoolProperty* BoolProperty = new FBoolProperty(Owner, Name, SYNTHETIC_FLAGS);
+				BoolProperty->SetBoolSize(sizeof(bool), /*bIsNativeBool = */ true);
+				return BoolProperty;
+			}
+			case 3:
+				return new FDoubleProperty(Owner, Name, SYNTHETIC_FLAGS);
+			case 4:
+				return new FStrProperty(Owner, Name, SYNTHETIC_FLAGS);
+			default:
+				return new FNameProperty(Owner, Name, SYNTHETIC_FLAGS);
+		}
+	}
+
+	void AddScalarProperties(UStruct& Owner, int32 NumProperties)
+	{
+		for (int32 Index = 0; Index < NumProperties; ++Index)
+		{
+			Owner.AddCppProperty(AddScalarProperty(&Owner, FName(TEXT("Property"), Index + 1), Index));
+		}
+	}
+
+	void AddArrayProperty(UStruct& Owner)
+	{
+		FArrayProperty* ArrayProperty = new FArrayProperty(&Owner, TEXT("Array"), SYNTHETIC_FLAGS);
+		ArrayProperty->AddCppProperty(new FIntProperty(ArrayProperty, TEXT("Array_Inner"), SYNTHETIC_FLAGS));
+		Owner.AddCppProperty(ArrayProperty);
+	}
+
+	void AddMapProperty(UStruct& Owner)
+	{
+		FMapProperty* MapProperty = new FMapProperty(&Owner, TEXT("Map"), SYNTHETIC_FLAGS);
+		MapProperty->AddCppProperty(new FIntProperty(MapProperty, TEXT("Map_Key"), SYNTHETIC_FLAGS));
+		MapProperty->AddCppProperty(new FFloatProperty(MapProperty, TEXT("Map_Value"), SYNTHETIC_FLAGS));
+		Owner.AddCppProperty(MapProperty);
+	}
+
+	void AddStructProperty(UStruct& Owner, UScriptStruct& InnerStruct)
+	{
+		FStructProperty* StructProperty = new FStructProperty(&Owner, TEXT("Nested"), SYNTHETIC_FLAGS);
+		StructProperty->Struct			= &InnerStruct;
+		Owner.AddCppProperty(StructProperty);
+	}
+
+	UScriptStruct* NewSyntheticStruct(const FString& Name)
+	{
+		const FName StructName = MakeUniqueObjectName(GetTransientPackage(), UScriptStruct::StaticClass(),
+													  *FString::Printf(TEXT("SrgImGuiBenchmark_%s"), *Name));
+		UScriptStruct* Struct  = NewObject<UScriptStruct>(GetTransientPackage(), StructName, SYNTHETIC_FLAGS);
+		Struct->AddToRoot();
+		SyntheticTypes.Add(Struct);
+		return Struct;
+	}
+
+	UClass* NewSyntheticClass(const FString& Name, bool Mutable)
+	{
+		const FName ClassName = MakeUniqueObjectName(GetTransientPackage(), UClass::StaticClass(),
+													 *FString::Printf(TEXT("SrgImGuiBenchmark_%s"), *Name));
+		UClass* Class		  = NewObject<UClass>(GetTransientPackage(), ClassName, SYNTHETIC_FLAGS);
+		Class->SetSuperStruct(UObject::StaticClass());
+		Class->ClassWithin	   = UObject::StaticClass();
+		Class->ClassConfigName = UObject::StaticClass()->ClassConfigName;
+		Class->ClassFlags |= CLASS_Transient;
+		if (Mutable)
+		{
+			Class->Interfaces.Add(FImplementedInterface(USrgImGuiMutable::StaticClass(), 0, /*bImplementedByK2 = */ true));
+		}
+		Class->AddToRoot();
+		SyntheticTypes.Add(Class);
+		return Class;
+	}
+
+	UStruct* NewSyntheticType(const FString& Name, bool Mutable, bool AsObject)
+	{
+		if (AsObject)
+		{
+			return NewSyntheticClass(Name, Mutable);
+		}
+		return NewSyntheticStruct(Name);
+	}
+
+	void LinkSyntheticType(UStruct& Type)
+	{
+		Type.Bind();
+		Type.StaticLink(/*bRelinkExistingProperties = */ true);
+		if (UClass* Class = Cast<UClass>(&Type))
+		{
+			Class->AssembleReferenceTokenStream(/*bForce = */ true);
+		}
+	}
+
+	void FillContainers(UStruct& Type, void* Data, int32 NumElements)
+	{
+		for (TFieldIterator<FProperty> PropIt(&Type); PropIt; ++PropIt)
+		{
+			if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(*PropIt))
+			{
+				FScriptArrayHelper_InContainer ArrayHelper(ArrayProperty, Data);
+				ArrayHelper.AddValues(NumElements);
+				for (int32 Index = 0; Index < NumElements; ++Index)
+				{
+					*reinterpret_cast<int32*>(ArrayHelper.GetRawPtr(Index)) = Index;
+				}
+			}
+			else if (FMapProperty* MapProperty = CastField<FMapProperty>(*PropIt))
+			{
+				FScriptMapHelper_InContainer MapHelper(MapProperty, Data);
+				for (int32 Index = 0; Index < NumElements; ++Index)
+				{
+					const int32 PairIndex = MapHelper.AddDefaultValue_Invalid_NeedsRehash();
+
+					*reinterpret_cast<int32*>(MapHelper.GetKeyPtr(PairIndex))	= Index;
+					*reinterpret_cast<float*>(MapHelper.GetValuePtr(PairIndex)) = static_cast<float>(Index);
+				}
+				MapHelper.Rehash();
+			}
+		}
+	}
+
+	void FinishCase(FBenchmarkCase& Case, UStruct& Type, int32 NumContainerElements)
+	{
+		LinkSyntheticType(Type);
+		Case.NumContainerElements = NumContainerElements;
+
+		if (UClass* Class = Cast<UClass>(&Type))
+		{
+			Case.Object = NewObject<UObject>(GetTransientPackage(), Class, NAME_None, RF_Transient);
+			Case.Object->AddToRoot();
+			FillContainers(Type, Case.Object, NumContainerElements);
+		}
+		else
+		{
+			Case.Struct		= CastChecked<UScriptStruct>(&Type);
+			Case.StructData = MakeShared<FStructOnScope>(Case.Struct);
+			FillContainers(Type, Case.StructData->GetStructMemory(), NumContainerElements);
+		}
+	}
+
+	void AddFlatCases(TArray<FBenchmarkCase>& Cases, bool Mutable, bool AsObject)
+	{
+		for (const int32 NumProperties : {10, 100, 1000, 5000})
+		{
+			FBenchmarkCase& Case = Cases.AddDefaulted_GetRef();
+			Case.Category		 = AsObject ? TEXT("Object") : TEXT("Struct");
+			Case.Name			 = FString::Printf(TEXT("%s_Flat_%d"), *Case.Category, NumProperties);
+			Case.NumProperties	 = NumProperties;
+			Case.Mutable		 = Mutable;
+
+			UStruct* Type = NewSyntheticType(Case.Name, Mutable, AsObject);
+			AddScalarProperties(*Type, NumProperties);
+			FinishCase(Case, *Type, 0);
+		}
+	}
+
+	void AddNestedCases(TArray<FBenchmarkCase>& Cases, bool Mutable, bool AsObject)
+	{
+		for (const int32 Depth : {2, 4, 8})
+		{
+			FBenchmarkCase& Case = Cases.AddDefaulted_GetRef();
+			Case.Category		 = AsObject ? TEXT("Object") : TEXT("Struct");
+			Case.Name			 = FString::Printf(TEXT("%s_Nested_Depth%d"), *Case.Category, Depth);
+			Case.Mutable		 = Mutable;
+
+			// Builds from the innermost struct outwards.
+			UScriptStruct* InnerStruct = nullptr;
+			for (int32 Level = Depth - 1; Level > 0; --Level)
+			{
+				UScriptStruct* LevelStruct = NewSyntheticStruct(FString::Printf(TEXT("%s_Level%d"), *Case.Name, Level));
+				AddScalarProperties(*LevelStruct, PROPERTIES_PER_NESTED_STRUCT);
+				if (InnerStruct)
+				{
+					AddStructProperty(*LevelStruct, *InnerStruct);
+				}
+				LinkSyntheticType(*LevelStruct);
+				InnerStruct = LevelStruct;
+			}
+
+			UStruct* Type = NewSyntheticType(Case.Name, Mutable, AsObject);
+			AddScalarProperties(*Type, PROPERTIES_PER_NESTED_STRUCT);
+			AddStructProperty(*Type, *InnerStruct);
+			Case.NumProperties = Depth * (PROPERTIES_PER_NESTED_STRUCT + 1) - 1;
+			FinishCase(Case, *Type, 0);
+		}
+	}
+
+	void AddContainerCases(TArray<FBenchmarkCase>& Cases, bool Mutable, bool AsObject)
+	{
+		for (const int32 NumElements : {10, 1000, 100000})
+		{
+			for (const bool IsMap : {false, true})
+			{
+				FBenchmarkCase& Case = Cases.AddDefaulted_GetRef();
+				Case.Category		 = AsObject ? TEXT("Object") : TEXT("Struct");
+				Case.Name = FString::Printf(TEXT("%s_%s_%d"), *Case.Category, IsMap ? TEXT("Map") : TEXT("Array"), NumElements);
+				Case.NumProperties = 1;
+				Case.Mutable	   = Mutable;
+
+				UStruct* Type = NewSyntheticType(Case.Name, Mutable, AsObject);
+				if (IsMap)
+				{
+					AddMapProperty(*Type);
+				}
+				else
+				{
+					AddArrayProperty(*Type);
+				}
+				FinishCase(Case, *Type, NumElements);
+			}
+		}
+	}
+
+	TArray<FBenchmarkCase> CreateCases(const FString& Filter)
+	{
+		TArray<FBenchmarkCase> Cases;
+		for (const bool AsObject : {false, true})
+		{
+			for (const bool Mutable : {false, true})
+			{
+				AddFlatCases(Cases, Mutable, AsObject);
+				AddNestedCases(Cases, Mutable, AsObject);
+				AddContainerCases(Cases, Mutable, AsObject);
+			}
+		}
+
+		if (!Filter.IsEmpty())
+		{
+			Cases.RemoveAll([&Filter](const FBenchmarkCase& Case) { return !Case.Name.Contains(Filter); });
+		}
+		return Cases;
+	}
+
+	void DestroyCases(TArray<FBenchmarkCase>& Cases)
+	{
+		for (FBenchmarkCase& Case : Cases)
+		{
+			Case.StructData.Reset();
+			if (Case.Object)
+			{
+				Case.Object->RemoveFromRoot();
+			}
+		}
+		Cases.Empty();
+
+		for (UStruct* Type : SyntheticTypes)
+		{
+			Type->RemoveFromRoot();
+		}
+		SyntheticTypes.Empty();
+	}
+
+	FBenchmarkResult RunCase(FSrgImGuiHeadlessContext& HeadlessContext, FBenchmarkCase& Case, int32 NumWarmupFrames,
+							 int32 NumFrames)
+	{
+		TArray<double> SamplesMs;
+		SamplesMs.Reserve(NumFrames);
+
+		FBenchmarkResult Result;
+		for (int32 Frame = 0; Frame < NumWarmupFrames + NumFrames; ++Frame)
+		{
+			HeadlessContext.BeginFrame();
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			if (Case.Object)
+			{
+				SrgImGuiTypeDrawer::DrawObjectValue(Case.Object, /*HasCollapsingHeader = */ false,
+													/*ForceDrawDefault = */ false, /*ExpandHeaders = */ true);
+			}
+			else
+			{
+				SrgImGuiTypeDrawer::DrawStructValue(Case.StructData->GetStructMemory(), Case.Struct, Case.Mutable,
+													/*HasCollapsingHeader = */ false, /*ExpandHeaders = */ true);
+			}
+			const uint64 EndCycles = FPlatformTime::Cycles64();
+
+			HeadlessContext.EndFrame();
+
+			if (Frame >= NumWarmupFrames)
+			{
+				SamplesMs.Add(FPlatformTime::ToMilliseconds64(EndCycles - StartCycles));
+			}
+			Result.Vertices = HeadlessContext.GetLastFrameVertexCount();
+		}
+
+		SamplesMs.Sort();
+		double TotalMs = 0.0;
+		for (const double SampleMs : SamplesMs)
+		{
+			TotalMs += SampleMs;
+		}
+		Result.MinMs	= SamplesMs[0];
+		Result.MedianMs = SamplesMs[SamplesMs.Num() / 2];
+		Result.MeanMs	= TotalMs / SamplesMs.Num();
+		Result.MaxMs	= SamplesMs.Last();
+		return Result;
+	}
+}	 // namespace SrgImGuiBenchmark_Private
+
+USrgImGuiBenchmarkCommandlet::USrgImGuiBenchmarkCommandlet()
+{
+	IsClient		= false;
+	IsServer		= false;
+	IsEditor		= true;
+	LogToConsole	= true;
+	ShowErrorCount	= true;
+	HelpDescription = TEXT("Times the SRG ImGui type drawers on synthetic types and writes the results to a CSV file.");
+	HelpUsage = TEXT("UnrealEditor-Cmd <Project> -run=SrgImGuiBenchmark -nullrhi [-Frames=100] [-Warmup=10] [-Filter=<Name>] "
+					 "[-Csv=<Path>]");
+}
+
+int32 USrgImGuiBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace SrgImGuiBenchmark_Private;
+
+	int32 NumFrames = 100;
+	FParse::Value(*Params, TEXT("Frames="), NumFrames);
+	NumFrames = FMath::Max(NumFrames, 1);
+
+	int32 NumWarmupFrames = 10;
+	FParse::Value(*Params, TEXT("Warmup="), NumWarmupFrames);
+	NumWarmupFrames = FMath::Max(NumWarmupFrames, 0);
+
+	FString Filter;
+	FParse::Value(*Params, TEXT("Filter="), Filter);
+
+	FString CsvPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SrgImGui"),
+									  FString::Printf(TEXT("Benchmark-%s.csv"), *FDateTime::Now().ToString()));
+	FParse::Value(*Params, TEXT("Csv="), CsvPath);
+
+	FSrgImGuiHeadlessContext HeadlessContext;
+
+	TArray<FBenchmarkCase> Cases = CreateCases(Filter);
+	UE_LOG(LogSrgImGuiBenchmark, Display, TEXT("Running %d SRG ImGui benchmark cases (%d warmup frames, %d frames)."),
+		   Cases.Num(), NumWarmupFrames, NumFrames);
+
+	TArray<FString> CsvLines;
+	CsvLines.Add(TEXT("Case,Category,Properties,ContainerElements,Mutable,Frames,MinMs,MedianMs,MeanMs,MaxMs,Vertices"));
+	for (FBenchmarkCase& Case : Cases)
+	{
+		const FBenchmarkResult Result = RunCase(HeadlessContext, Case, NumWarmupFrames, NumFrames);
+		const TCHAR* MutableText	  = Case.Mutable ? TEXT("Mutable") : TEXT("ReadOnly");
+
+		UE_LOG(LogSrgImGuiBenchmark, Display, TEXT("%-32s %-8s median %8.3f ms, max %8.3f ms"), *Case.Name, MutableText,
+			   Result.MedianMs, Result.MaxMs);
+		CsvLines.Add(FString::Printf(TEXT("%s,%s,%d,%d,%s,%d,%.4f,%.4f,%.4f,%.4f,%d"), *Case.Name, *Case.Category,
+									 Case.NumProperties, Case.NumContainerElements, MutableText, NumFrames, Result.MinMs,
+									 Result.MedianMs, Result.MeanMs, Result.MaxMs, Result.Vertices));
+	}
+
+	DestroyCases(Cases);
+
+	if (!FFileHelper::SaveStringArrayToFile(CsvLines, *CsvPath))
+	{
+		UE_LOG(LogSrgImGuiBenchmark, Error, TEXT("Failed to write the SRG ImGui benchmark results to [%s]."), *CsvPath);
+		return 1;
+	}
+
+	UE_LOG(LogSrgImGuiBenchmark, Display, TEXT("SRG ImGui benchmark results written to [%s]."), *CsvPath);
+	return 0;
+}
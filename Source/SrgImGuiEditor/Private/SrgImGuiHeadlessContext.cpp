@@ -0,0 +1,53 @@
+// © Surgent Studios
+
+#include "SrgImGuiHeadlessContext.h"
+
+#include <imgui.h>
+
+#include "SrgImGuiStats.h"
+
+FSrgImGuiHeadlessContext::FSrgImGuiHeadlessContext()
+{
+	PreviousContext = ImGui::GetCurrentContext();
+	Context			= ImGui::CreateContext();
+	ImGui::SetCurrentContext(Context);
+
+	ImGuiIO& IO	   = ImGui::GetIO();
+	IO.DisplaySize = ImVec2(1920.f, 1080.f);
+	IO.DeltaTime   = 1.f / 60.f;
+	IO.IniFilename = nullptr;
+	IO.LogFilename = nullptr;
+
+	// The font atlas needs to be built before the first frame, even though nothing is rendered.
+	unsigned char* FontPixels = nullptr;
+	int32 FontWidth			  = 0;
+	int32 FontHeight		  = 0;
+	IO.Fonts->GetTexDataAsRGBA32(&FontPixels, &FontWidth, &FontHeight);
+}
+
+FSrgImGuiHeadlessContext::~FSrgImGuiHeadlessContext()
+{
+	ImGui::DestroyContext(Context);
+	ImGui::SetCurrentContext(PreviousContext);
+}
+
+void FSrgImGuiHeadlessContext::BeginFrame()
+{
+	ImGui::NewFrame();
+	ImGui::SetNextWindowPos(ImVec2(0.f, 0.f));
+	ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+	ImGui::Begin("SrgImGui Headless");
+}
+
+void FSrgImGuiHeadlessContext::EndFrame()
+{
+	ImGui::End();
+	ImGui::Render();
+	SrgImGuiStats::FlushFrameCounters();
+}
+
+int32 FSrgImGuiHeadlessContext::GetLastFrameVertexCount() const
+{
+	const ImDrawData* DrawData = ImGui::GetDrawData();
+	return DrawData ? DrawData->TotalVtxCount : 0;
+}
@@ -0,0 +1,385 @@
+// © Surgent Studios
+
+#include "SrgImGuiTypeSweepCommandlet.h"
+
+#include <atomic>
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Engine/Blueprint.h"
+#include "Engine/UserDefinedStruct.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/StructOnScope.h"
+#include "UObject/UObjectIterator.h"
+
+#include "SrgImGuiHeadlessContext.h"
+#include "TypeDrawer/SrgImGuiTypeDrawer.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSrgImGuiTypeSweep, Log, All);
+
+namespace SrgImGuiTypeSweep_Private
+{
+	/**
+	 * Forwards every call to the allocator it wraps and counts the allocations made by one thread while counting is enabled.
+	 * It is installed as GMalloc for the duration of the sweep, with the worker threads fenced around the swap. Memory allocated
+	 * through it belongs to the wrapped allocator, so blocks can be freed through either of them.
+	 */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCountingMalloc(FMalloc* InInnerMalloc)
+			: InnerMalloc(InInnerMalloc)
+		{
+		}
+
+		void BeginCounting()
+		{
+			CountingThreadId = FPlatformTLS::GetCurrentThreadId();
+			NumAllocations	 = 0;
+			AllocatedBytes	 = 0;
+			IsCounting.store(true, std::memory_order_release);
+		}
+
+		void EndCounting() { IsCounting.store(false, std::memory_order_release); }
+
+		uint64 GetNumAllocations() const { return NumAllocations; }
+		uint64 GetAllocatedBytes() const { return AllocatedBytes; }
+		FMalloc* GetInnerMalloc() const { return InnerMalloc; }
+
+		//~ Begin FMalloc Interface
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation(Count);
+			return InnerMalloc->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation(Count);
+			return InnerMalloc->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation(Count);
+			return InnerMalloc->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation(Count);
+			return InnerMalloc->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+		{
+			return InnerMalloc->QuantizeSize(Count, Alignment);
+		}
+
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+		{
+			return InnerMalloc->GetAllocationSize(Original, SizeOut);
+		}
+
+		virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { InnerMalloc->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+		{
+			InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread();
+		}
+		virtual void UpdateStats() override { InnerMalloc->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { InnerMalloc->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { InnerMalloc->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return InnerMalloc->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return InnerMalloc->GetDescriptiveName(); }
+		//~ End FMalloc Interface
+
+	private:
+		void CountAllocation(SIZE_T Count)
+		{
+			if (IsCounting.load(std::memory_order_acquire) && Count > 0 && FPlatformTLS::GetCurrentThreadId() == CountingThreadId)
+			{
+				++NumAllocations;
+				AllocatedBytes += Count;
+			}
+		}
+
+		FMalloc* InnerMalloc = nullptr;
+		std::atomic<bool> IsCounting{false};
+		uint32 CountingThreadId = 0;
+		uint64 NumAllocations	= 0;
+		uint64 AllocatedBytes	= 0;
+	};
+
+	// Waits for the loading and task graph threads to finish what they are running, so that none of them is still inside a
+	// call to GMalloc when it is replaced.
+	void FenceWorkerThreads()
+	{
+		FlushAsyncLoading();
+		TFunction<void(ENamedThreads::Type)> Fence = [](ENamedThreads::Type) {};
+		FTaskGraphInterface::Get().BroadcastSlow_OnlyUseForSpecialPurposes(true, true, Fence);
+	}
+
+	struct FSweepSettings
+	{
+		FString Filter;
+		int32 NumFrames = 5;
+		bool Mutable	= false;
+	};
+
+	struct FTypeResult
+	{
+		FString PathName;
+		FString Kind;
+		int32 NumProperties = 0;
+		double MedianMs		= 0.0;
+		double MaxMs		= 0.0;
+		// Per frame, taken from the last frame drawn as the first one includes ImGui's one-off allocations.
+		uint64 NumAllocations = 0;
+		uint64 AllocatedBytes = 0;
+		int32 Vertices		  = 0;
+		// Path of each unsupported property to the name of its field class.
+		TMap<FString, FString> UnsupportedProperties;
+	};
+
+	bool IsTypeRelevant(const UStruct& Type, const FString& Filter)
+	{
+		const FString Name = Type.GetName();
+		if (Name.StartsWith(TEXT("SKEL_")) || Name.StartsWith(TEXT("REINST_")) || Name.StartsWith(TEXT("TRASH")) ||
+			Name.StartsWith(TEXT("SrgImGuiBenchmark_")))
+		{
+			return false;
+		}
+
+		if (const UClass* Class = Cast<UClass>(&Type))
+		{
+			if (Class->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
+			{
+				return false;
+			}
+		}
+		else if (const UScriptStruct* Struct = Cast<UScriptStruct>(&Type))
+		{
+			// The struct is default constructed to be drawn, which asserts for abstract structs and for native structs that do
+			// not export their constructor.
+			const UScriptStruct::ICppStructOps* StructOps = Struct->GetCppStructOps();
+			if (StructOps ? StructOps->IsAbstract() : Struct->HasAnyStructFlags(STRUCT_Native))
+			{
+				return false;
+			}
+		}
+
+		return Filter.IsEmpty() || Type.GetPathName().Contains(Filter);
+	}
+
+	void LoadBlueprintTypes(const FString& Filter)
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		AssetRegistry.SearchAllAssets(/*bSynchronousSearch = */ true);
+
+		TArray<FAssetData> Assets;
+		AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), Assets, /*bSearchSubClasses = */ true);
+		AssetRegistry.GetAssetsByClass(UUserDefinedStruct::StaticClass()->GetClassPathName(), Assets);
+
+		int32 NumLoaded = 0;
+		for (const FAssetData& Asset : Assets)
+		{
+			if (Filter.IsEmpty() || Asset.GetObjectPathString().Contains(Filter))
+			{
+				NumLoaded += Asset.GetAsset() ? 1 : 0;
+			}
+		}
+		UE_LOG(LogSrgImGuiTypeSweep, Display, TEXT("Loaded %d blueprint and user defined struct assets."), NumLoaded);
+	}
+
+	int32 CountProperties(const UStruct& Type)
+	{
+		int32 NumProperties = 0;
+		for (TFieldIterator<FProperty> PropIt(&Type); PropIt; ++PropIt)
+		{
+			++NumProperties;
+		}
+		return NumProperties;
+	}
+
+	FTypeResult SweepType(FSrgImGuiHeadlessContext& HeadlessContext, FCountingMalloc& CountingMalloc, UStruct& Type,
+						  const FSweepSettings& Settings)
+	{
+		FTypeResult Result;
+		Result.PathName		 = Type.GetPathName();
+		Result.Kind			 = Type.IsA<UClass>() ? TEXT("Class") : TEXT("Struct");
+		Result.NumProperties = CountProperties(Type);
+
+		const FDelegateHandle UnsupportedHandle = SrgImGuiTypeDrawer::OnUnsupportedProperty().AddLambda(
+			[&Result](const FProperty& Property)
+			{
+				Result.UnsupportedProperties.Add(Property.GetPathName(), Property.GetClass()->GetName());
+			});
+
+		TUniquePtr<FStructOnScope> StructData;
+		UScriptStruct* Struct = Cast<UScriptStruct>(&Type);
+		if (Struct)
+		{
+			StructData = MakeUnique<FStructOnScope>(Struct);
+		}
+
+		TArray<double> SamplesMs;
+		for (int32 Frame = 0; Frame < Settings.NumFrames; ++Frame)
+		{
+			HeadlessContext.BeginFrame();
+
+			CountingMalloc.BeginCounting();
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			if (Struct)
+			{
+				SrgImGuiTypeDrawer::DrawStructValue(StructData->GetStructMemory(), Struct, Settings.Mutable,
+													/*HasCollapsingHeader = */ false, /*ExpandHeaders = */ true);
+			}
+			else
+			{
+				// The default drawer is forced so that no custom drawer logic runs on class default objects.
+				UObject* DefaultObject = CastChecked<UClass>(&Type)->GetDefaultObject();
+				SrgImGuiTypeDrawer::DrawObjectValue(DefaultObject, /*HasCollapsingHeader = */ false, /*ForceDrawDefault = */ true,
+													/*ExpandHeaders = */ true);
+			}
+			const uint64 EndCycles = FPlatformTime::Cycles64();
+			CountingMalloc.EndCounting();
+
+			HeadlessContext.EndFrame();
+
+			SamplesMs.Add(FPlatformTime::ToMilliseconds64(EndCycles - StartCycles));
+			Result.NumAllocations = CountingMalloc.GetNumAllocations();
+			Result.AllocatedBytes = CountingMalloc.GetAllocatedBytes();
+			Result.Vertices		  = HeadlessContext.GetLastFrameVertexCount();
+		}
+
+		SrgImGuiTypeDrawer::OnUnsupportedProperty().Remove(UnsupportedHandle);
+
+		SamplesMs.Sort();
+		Result.MedianMs = SamplesMs[SamplesMs.Num() / 2];
+		Result.MaxMs	= SamplesMs.Last();
+		return Result;
+	}
+
+	FString ToCsvLine(const FTypeResult& Result)
+	{
+		TArray<FString> UnsupportedProperties;
+		for (const TPair<FString, FString>& Pair : Result.UnsupportedProperties)
+		{
+			UnsupportedProperties.Add(FString::Printf(TEXT("%s (%s)"), *Pair.Key, *Pair.Value));
+		}
+		UnsupportedProperties.Sort();
+		return FString::Printf(TEXT("%s,%s,%d,%.4f,%.4f,%llu,%llu,%d,\"%s\""), *Result.PathName, *Result.Kind,
+							   Result.NumProperties, Result.MedianMs, Result.MaxMs, Result.NumAllocations, Result.AllocatedBytes,
+							   Result.Vertices, *FString::Join(UnsupportedProperties, TEXT(";")));
+	}
+}	 // namespace SrgImGuiTypeSweep_Private
+
+USrgImGuiTypeSweepCommandlet::USrgImGuiTypeSweepCommandlet()
+{
+	IsClient		= false;
+	IsServer		= false;
+	IsEditor		= true;
+	LogToConsole	= true;
+	ShowErrorCount	= true;
+	HelpDescription = TEXT("Draws every reflected struct and class through the SRG ImGui type drawers and reports their cost.");
+	HelpUsage = TEXT("UnrealEditor-Cmd <Project> -run=SrgImGuiTypeSweep -nullrhi [-Filter=<Path>] [-LoadAssets] [-Mutable] "
+					 "[-Frames=5] [-BudgetMs=0.5] [-Csv=<Path>]");
+}
+
+int32 USrgImGuiTypeSweepCommandlet::Main(const FString& Params)
+{
+	using namespace SrgImGuiTypeSweep_Private;
+
+	FSweepSettings Settings;
+	FParse::Value(*Params, TEXT("Filter="), Settings.Filter);
+	FParse::Value(*Params, TEXT("Frames="), Settings.NumFrames);
+	Settings.NumFrames = FMath::Max(Settings.NumFrames, 1);
+	Settings.Mutable   = FParse::Param(*Params, TEXT("Mutable"));
+
+	double BudgetMs = 0.0;
+	FParse::Value(*Params, TEXT("BudgetMs="), BudgetMs);
+
+	FString CsvPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SrgImGui"),
+									  FString::Printf(TEXT("TypeSweep-%s.csv"), *FDateTime::Now().ToString()));
+	FParse::Value(*Params, TEXT("Csv="), CsvPath);
+
+	if (FParse::Param(*Params, TEXT("LoadAssets")))
+	{
+		LoadBlueprintTypes(Settings.Filter);
+	}
+
+	// Gathered up front as drawing can load or create new types while iterating.
+	TArray<UStruct*> Types;
+	for (TObjectIterator<UScriptStruct> It; It; ++It)
+	{
+		if (IsTypeRelevant(**It, Settings.Filter))
+		{
+			Types.Add(*It);
+		}
+	}
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		if (IsTypeRelevant(**It, Settings.Filter))
+		{
+			Types.Add(*It);
+		}
+	}
+	UE_LOG(LogSrgImGuiTypeSweep, Display, TEXT("Sweeping %d types (%d frames each)."), Types.Num(), Settings.NumFrames);
+
+	FSrgImGuiHeadlessContext HeadlessContext;
+
+	FenceWorkerThreads();
+	FCountingMalloc* CountingMalloc = new FCountingMalloc(GMalloc);
+	GMalloc							= CountingMalloc;
+
+	TArray<FTypeResult> Results;
+	Results.Reserve(Types.Num());
+	for (UStruct* Type : Types)
+	{
+		Results.Add(SweepType(HeadlessContext, *CountingMalloc, *Type, Settings));
+	}
+
+	GMalloc = CountingMalloc->GetInnerMalloc();
+	// The counting allocator is leaked on purpose: threads that are not fenced (e.g. the threaded log, DDC or IO workers)
+	// can still hold it or be inside one of its calls, so freeing it would be a use after free.
+
+	Results.Sort([](const FTypeResult& A, const FTypeResult& B) { return A.MedianMs > B.MedianMs; });
+
+	TMap<FString, int32> UnsupportedTypeCounts;
+	TArray<FString> CsvLines;
+	CsvLines.Add(TEXT("Type,Kind,Properties,MedianMs,MaxMs,Allocations,AllocatedBytes,Vertices,UnsupportedProperties"));
+	for (const FTypeResult& Result : Results)
+	{
+		CsvLines.Add(ToCsvLine(Result));
+
+		for (const TPair<FString, FString>& Pair : Result.UnsupportedProperties)
+		{
+			++UnsupportedTypeCounts.FindOrAdd(Pair.Value);
+		}
+
+		if (BudgetMs > 0.0 && Result.MedianMs > BudgetMs)
+		{
+			UE_LOG(LogSrgImGuiTypeSweep, Warning, TEXT("[%s] takes %.3f ms to draw, over the %.3f ms budget."), *Result.PathName,
+				   Result.MedianMs, BudgetMs);
+		}
+	}
+
+	for (const TPair<FString, int32>& Pair : UnsupportedTypeCounts)
+	{
+		UE_LOG(LogSrgImGuiTypeSweep, Display, TEXT("Unsupported property type [%s] found %d times."), *Pair.Key, Pair.Value);
+	}
+
+	if (!FFileHelper::SaveStringArrayToFile(CsvLines, *CsvPath))
+	{
+		UE_LOG(LogSrgImGuiTypeSweep, Error, TEXT("Failed to write the SRG ImGui type sweep results to [%s]."), *CsvPath);
+		return 1;
+	}
+
+	UE_LOG(LogSrgImGuiTypeSweep, Display, TEXT("SRG ImGui type sweep results written to [%s]."), *CsvPath);
+	return 0;
+}
@@ -4,6 +4,7 @@
 
 #include "BlueprintActionDatabaseRegistrar.h"
 #include "BlueprintNodeSpawner.h"
+#include "KismetCompiler.h"
 
 #include "Library/SrgImGuiTypeLibrary.h"
 
@@ -52,6 +53,72 @@ bool USrgImGui_K2Node_DrawWildcard::IsConnectionDisallowed(const UEdGraphPin* My
 	return false;
 }
 
+void USrgImGui_K2Node_DrawWildcard::ExpandNode(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	Super::ExpandNode(CompilerContext, SourceGraph);
+
+	const UFunction* Function = GetTargetFunction();
+	if (!Function)
+	{
+		return;
+	}
+
+	FName PlannedFunctionName;
+	FName DataPinName;
+	FName TypePinName;
+	if (Function->GetFName() == GET_FUNCTION_NAME_CHECKED(USrgImGuiTypeLibrary, DrawStruct_K2Node))
+	{
+		PlannedFunctionName = GET_FUNCTION_NAME_CHECKED(USrgImGuiTypeLibrary, DrawStruct_Planned);
+		DataPinName			= GetStructDataInputPinName();
+		TypePinName			= TEXT("StructType");
+	}
+	else if (Function->GetFName() == GET_FUNCTION_NAME_CHECKED(USrgImGuiTypeLibrary, DrawClass_K2Node))
+	{
+		PlannedFunctionName = GET_FUNCTION_NAME_CHECKED(USrgImGuiTypeLibrary, DrawClass_Planned);
+		DataPinName			= GetClassDataInputPinName();
+		TypePinName			= TEXT("MetaClass");
+	}
+	else if (Function->GetFName() == GET_FUNCTION_NAME_CHECKED(USrgImGuiTypeLibrary, DrawSoftClass_K2Node))
+	{
+		PlannedFunctionName = GET_FUNCTION_NAME_CHECKED(USrgImGuiTypeLibrary, DrawSoftClass_Planned);
+		DataPinName			= GetSoftClassDataInputPinName();
+		TypePinName			= TEXT("MetaClass");
+	}
+	else
+	{
+		return;
+	}
+
+	// Without a resolved type the node keeps calling the generic function, which reports the error at runtime.
+	UEdGraphPin* DataPin_Self = FindPinChecked(DataPinName);
+	UObject* Type			  = DataPin_Self->PinType.PinSubCategoryObject.Get();
+	if (DataPin_Self->PinType.PinCategory == UEdGraphSchema_K2::PC_Wildcard || !Type)
+	{
+		return;
+	}
+
+	UK2Node_CallFunction* PlannedNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+	PlannedNode->SetFromFunction(USrgImGuiTypeLibrary::StaticClass()->FindFunctionByName(PlannedFunctionName));
+	PlannedNode->AllocateDefaultPins();
+
+	UEdGraphPin* DataPin_Intermediate = PlannedNode->FindPinChecked(DataPinName);
+	DataPin_Intermediate->PinType	  = DataPin_Self->PinType;
+
+	UEdGraphPin* TypePin_Intermediate	= PlannedNode->FindPinChecked(TypePinName);
+	TypePin_Intermediate->DefaultObject = Type;
+
+	// Every other pin of the node has a pin with the same name on the planned function.
+	for (UEdGraphPin* Pin_Self : Pins)
+	{
+		if (UEdGraphPin* Pin_Intermediate = PlannedNode->FindPin(Pin_Self->PinName, Pin_Self->Direction))
+		{
+			CompilerContext.MovePinLinksToIntermediate(*Pin_Self, *Pin_Intermediate);
+		}
+	}
+
+	BreakAllNodeLinks();
+}
+
 void USrgImGui_K2Node_DrawWildcard::GetMenuActions(FBlueprintActionDatabaseRegistrar& InActionRegistrar) const
 {
 	Super::GetMenuActions(InActionRegistrar);
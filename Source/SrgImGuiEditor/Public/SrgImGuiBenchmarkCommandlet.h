@@ -0,0 +1,31 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "SrgImGuiBenchmarkCommandlet.generated.h"
+
+/**
+ * Times SrgImGuiTypeDrawer::DrawStructValue and SrgImGuiTypeDrawer::DrawObjectValue on synthetic types inside a standalone
+ * ImGui context and writes the results to a CSV file.
+ * The synthetic types range from 10 to 5000 properties, nested structs and containers of 10 to 100k elements, each drawn
+ * in read-only and mutable mode with every collapsing header open.
+ *
+ * Usage (runs headless):
+ * UnrealEditor-Cmd <Project> -run=SrgImGuiBenchmark -nullrhi -unattended [-Frames=100] [-Warmup=10] [-Filter=Nested]
+ * [-Csv=<Path>]
+ */
+UCLASS()
+class USrgImGuiBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USrgImGuiBenchmarkCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
@@ -0,0 +1,30 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct ImGuiContext;
+
+/**
+ * Standalone ImGui context used to draw without a viewport (e.g. in commandlets running with -nullrhi).
+ * It becomes the current context for its lifetime and restores the previous one when destroyed, so it does not interfere
+ * with the contexts owned by the ImGui plugin.
+ */
+class SRGIMGUIEDITOR_API FSrgImGuiHeadlessContext : public FNoncopyable
+{
+public:
+	FSrgImGuiHeadlessContext();
+	~FSrgImGuiHeadlessContext();
+
+	// Starts a new frame with a single window covering the whole display. Everything drawn until EndFrame goes in that window.
+	void BeginFrame();
+	void EndFrame();
+
+	// Number of vertices generated by the last frame.
+	int32 GetLastFrameVertexCount() const;
+
+private:
+	ImGuiContext* Context		  = nullptr;
+	ImGuiContext* PreviousContext = nullptr;
+};
@@ -0,0 +1,31 @@
+// © Surgent Studios
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "SrgImGuiTypeSweepCommandlet.generated.h"
+
+/**
+ * Draws a default instance of every UScriptStruct and the default object of every UClass through SrgImGuiTypeDrawer in a
+ * standalone ImGui context.
+ * Records the draw time, the game thread allocations and the unsupported property types of each type and writes them to a
+ * CSV file sorted by cost, so that types too expensive to inspect live can be found before shipping.
+ *
+ * Usage (runs headless):
+ * UnrealEditor-Cmd <Project> -run=SrgImGuiTypeSweep -nullrhi -unattended [-Filter=/Script/MyGame] [-LoadAssets] [-Mutable]
+ * [-Frames=5] [-BudgetMs=0.5] [-Csv=<Path>]
+ */
+UCLASS()
+class USrgImGuiTypeSweepCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USrgImGuiTypeSweepCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
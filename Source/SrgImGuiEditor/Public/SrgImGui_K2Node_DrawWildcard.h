@@ -7,6 +7,11 @@
 
 #include "SrgImGui_K2Node_DrawWildcard.generated.h"
 
+/**
+ * Node for "ImGui - Struct", "ImGui - Class" and "ImGui - Soft Class".
+ * Once its value pin is connected, the node compiles into a call to the matching "_Planned" function of
+ * USrgImGuiTypeLibrary, with the connected type as a literal. Unconnected nodes compile into the generic "_K2Node" function.
+ */
 UCLASS(MinimalAPI)
 class USrgImGui_K2Node_DrawWildcard : public UK2Node_CallFunction
 {
@@ -22,5 +27,6 @@ class USrgImGui_K2Node_DrawWildcard : public UK2Node_CallFunction
 
 	//~ Begin K2Node Interface
 	virtual bool IsConnectionDisallowed(const UEdGraphPin* MyPin, const UEdGraphPin* OtherPin, FString& OutReason) const override;
+	virtual void ExpandNode(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
 	//~ End K2Node Interface
 };